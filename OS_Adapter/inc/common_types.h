@@ -21,6 +21,14 @@ typedef void * osal_sema_handle_t;
 typedef void * osal_mutex_handle_t;
 typedef void * osal_queue_handle_t;
 typedef void * osal_timer_handle_t;
+typedef void * osal_ringbuf_handle_t;
+typedef void * osal_wait_set_handle_t;
+typedef void * osal_event_handle_t;
+typedef void * osal_pool_handle_t;
+typedef void * osal_arena_handle_t;
+typedef void * osal_periodic_handle_t;
+typedef void * osal_workqueue_handle_t;
+typedef uint32_t osal_event_bits_t;
 
 #define OSAL_TRUE  ( (osal_base_type_t) 1)
 #define OSAL_FALSE ( (osal_base_type_t) 0)
@@ -4,14 +4,21 @@
 #include <string.h>
 #include <stdint.h>
 #include "common_types.h"
+#include "osal_arena.h"
 #include "osal_config.h"
 #include "osal_error.h"
+#include "osal_event.h"
 #include "osal_heap.h"
 #include "osal_macros.h"
 #include "osal_mutex.h"
+#include "osal_pool.h"
 #include "osal_queue.h"
+#include "osal_ringbuf.h"
 #include "osal_sema.h"
 #include "osal_task.h"
+#include "osal_time.h"
 #include "osal_timer.h"
+#include "osal_wait.h"
+#include "osal_workqueue.h"
 
 #endif // __OSAL_H__
@@ -0,0 +1,47 @@
+#ifndef __OSAL_ARENA_H__
+#define __OSAL_ARENA_H__
+
+#include "common_types.h"
+
+/*
+ * Arena allocator
+ * One osal_heap_malloc() block handed out by bumping an offset, 8-byte aligned. Nothing is
+ * freed on its own: roll back to a mark or reset to release everything allocated after it.
+ * An arena is not locked, keep it to one task or serialize the callers.
+ * Passing NULL as the handle uses the calling task's default arena.
+ */
+typedef size_t osal_arena_mark_t;
+
+typedef struct
+{
+    size_t size;
+    size_t used;
+    size_t high_water;     // most bytes in use since creation
+    uint32_t failures;     // allocations that did not fit
+} osal_arena_stats_t;
+
+int32_t osal_arena_create(size_t size, osal_arena_handle_t *p_arena_handle);
+
+int32_t osal_arena_delete(osal_arena_handle_t arena_handle);
+
+/* NULL when the arena has no room left. */
+void *osal_arena_alloc(osal_arena_handle_t arena_handle, size_t size);
+
+osal_arena_mark_t osal_arena_mark(osal_arena_handle_t arena_handle);
+
+/* Releases everything allocated after mark was taken. */
+int32_t osal_arena_rollback(osal_arena_handle_t arena_handle, osal_arena_mark_t mark);
+
+int32_t osal_arena_reset(osal_arena_handle_t arena_handle);
+
+int32_t osal_arena_get_stats(osal_arena_handle_t arena_handle, osal_arena_stats_t *p_stats);
+
+/*
+ * Default arena of the calling task, NULL to clear. Not available from an ISR.
+ * OSAL_ERR_NOT_IMPLEMENTED on FreeRTOS builds without a free thread local storage slot.
+ */
+int32_t osal_arena_set_task_default(osal_arena_handle_t arena_handle);
+
+osal_arena_handle_t osal_arena_get_task_default(void);
+
+#endif // __OSAL_ARENA_H__
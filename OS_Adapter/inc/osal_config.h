@@ -6,9 +6,183 @@
 #define FREERTOS_SUPPORT    (1)
 #define ZEPHYR_SUPPORT      (2)
 #define THREADX_SUPPORT     (3) 
+#define POSIX_SUPPORT       (4)
 
 /* Which rtos to choose. */
+#ifndef OSAL_RTOS_SUPPORT
 #define OSAL_RTOS_SUPPORT (FREERTOS_SUPPORT)
+#endif
+
+/* Shared-index structures pad to this so producer and consumer never share a line. */
+#ifndef OSAL_CACHE_LINE_SIZE
+#if (OSAL_RTOS_SUPPORT == POSIX_SUPPORT)
+#define OSAL_CACHE_LINE_SIZE (64)
+#else
+#define OSAL_CACHE_LINE_SIZE (32)
+#endif
+#endif
+
+/*
+ * Allocator behind osal_heap_malloc().
+ * 0: the kernel's own (pvPortMalloc, tx_byte_allocate, malloc).
+ * 1: the OSAL TLSF heap, O(1) malloc and free with bounded fragmentation. It manages a static
+ *    array of OSAL_HEAP_POOL_SIZE bytes, or the linker region between the symbols named by
+ *    OSAL_HEAP_REGION_START and OSAL_HEAP_REGION_END when both are defined.
+ */
+#ifndef OSAL_HEAP_USE_TLSF
+#define OSAL_HEAP_USE_TLSF (0)
+#endif
+
+/*
+ * Heap tracing, see osal_heap_trace_*(). Every heap call, the OSAL's own object allocations
+ * included, goes into a ring of OSAL_HEAP_TRACE_DEPTH records, and up to OSAL_HEAP_TRACE_LIVE_MAX
+ * (a power of two) outstanding allocations are tracked for leak checks.
+ */
+#ifndef OSAL_HEAP_TRACE_ENABLE
+#define OSAL_HEAP_TRACE_ENABLE (0)
+#endif
+
+#ifndef OSAL_HEAP_TRACE_DEPTH
+#define OSAL_HEAP_TRACE_DEPTH (256)
+#endif
+
+#ifndef OSAL_HEAP_TRACE_LIVE_MAX
+#define OSAL_HEAP_TRACE_LIVE_MAX (512)
+#endif
+
+/*
+ * Per-task cache in front of osal_heap_malloc()/osal_heap_free(). Requests up to
+ * 16 << (OSAL_HEAP_CACHE_CLASSES - 1) bytes are served from free lists owned by the calling
+ * task, without the heap lock. A class holds at most OSAL_HEAP_CACHE_DEPTH blocks and moves
+ * half a depth at a time: surplus batches are parked in a shared depot of OSAL_HEAP_CACHE_DEPOT
+ * batches per class, where a task that runs dry picks them up, so blocks freed by a consumer
+ * go back to the producer without a heap call. Every osal_heap_malloc() block carries a
+ * header of two words, and cached blocks still count as used in osal_heap_get_stats().
+ */
+#ifndef OSAL_HEAP_CACHE_ENABLE
+#define OSAL_HEAP_CACHE_ENABLE (0)
+#endif
+
+#ifndef OSAL_HEAP_CACHE_CLASSES
+#define OSAL_HEAP_CACHE_CLASSES (4)
+#endif
+
+#ifndef OSAL_HEAP_CACHE_DEPTH
+#define OSAL_HEAP_CACHE_DEPTH (8)
+#endif
+
+#ifndef OSAL_HEAP_CACHE_DEPOT
+#define OSAL_HEAP_CACHE_DEPOT (4)
+#endif
+
+/*
+ * Interrupt side of osal_heap, set up by osal_heap_init(). osal_heap_malloc() from an ISR is
+ * served from a lock-free reserve of OSAL_HEAP_ISR_RESERVE_COUNT blocks of
+ * OSAL_HEAP_ISR_RESERVE_SIZE bytes (0 blocks: NULL), osal_heap_free() from an ISR queues the
+ * block for the "osal_heap" task. Keep that task below the application tasks.
+ */
+#ifndef OSAL_HEAP_ISR_RESERVE_COUNT
+#define OSAL_HEAP_ISR_RESERVE_COUNT (8)
+#endif
+
+#ifndef OSAL_HEAP_ISR_RESERVE_SIZE
+#define OSAL_HEAP_ISR_RESERVE_SIZE (128)
+#endif
+
+#ifndef OSAL_HEAP_DEFER_TASK_PRIORITY
+#if (OSAL_RTOS_SUPPORT == THREADX_SUPPORT)
+#define OSAL_HEAP_DEFER_TASK_PRIORITY (30)   // ThreadX counts 0 as the highest priority
+#else
+#define OSAL_HEAP_DEFER_TASK_PRIORITY (1)
+#endif
+#endif
+
+#ifndef OSAL_HEAP_DEFER_TASK_STACK
+#define OSAL_HEAP_DEFER_TASK_STACK (1024)
+#endif
+
+/*
+ * Context switch counts in osal_task_get_stats() on FreeRTOS, which does not keep them. Takes
+ * one more thread local storage slot and needs traceTASK_SWITCHED_IN() to call
+ * osal_task_switched_in(). ThreadX and POSIX always count.
+ */
+#ifndef OSAL_TASK_SWITCH_COUNT_ENABLE
+#define OSAL_TASK_SWITCH_COUNT_ENABLE (0)
+#endif
+
+/* Callbacks osal_heap_watch_add() can register. */
+#ifndef OSAL_HEAP_WATCH_MAX
+#define OSAL_HEAP_WATCH_MAX (4)
+#endif
+
+/*
+ * Emergency heap of OSAL_HEAP_EMERGENCY_SIZE bytes, taken from the heap by osal_heap_init().
+ * When the heap cannot serve an osal_heap_malloc(), tasks at OSAL_HEAP_EMERGENCY_PRIORITY or
+ * more urgent fall back to it. 0 disables it. The TLSF control block, about 1.2 KB on
+ * 32-bit targets, comes out of the same bytes.
+ */
+#ifndef OSAL_HEAP_EMERGENCY_SIZE
+#define OSAL_HEAP_EMERGENCY_SIZE (0)
+#endif
+
+#ifndef OSAL_HEAP_EMERGENCY_PRIORITY
+#if (OSAL_RTOS_SUPPORT == THREADX_SUPPORT)
+#define OSAL_HEAP_EMERGENCY_PRIORITY (8)
+#else
+#define OSAL_HEAP_EMERGENCY_PRIORITY (4)
+#endif
+#endif
+
+/* Named heaps that osal_heap_region_add() can register besides the default one. */
+#ifndef OSAL_HEAP_REGION_MAX
+#define OSAL_HEAP_REGION_MAX (4)
+#endif
+
+#ifndef OSAL_HEAP_POOL_SIZE
+#if (OSAL_RTOS_SUPPORT == POSIX_SUPPORT)
+#define OSAL_HEAP_POOL_SIZE (1048576)
+#else
+#define OSAL_HEAP_POOL_SIZE (20480)
+#endif
+#endif
+
+/*
+ * Storage behind the osal_*_static_t types of the *_create_static() calls, in pointer-sized
+ * words so one value fits 32 and 64-bit builds. Every backend checks its control blocks
+ * against them at compile time, raise them when kernel options make an object larger.
+ */
+#ifndef OSAL_TASK_STATIC_WORDS
+#if (OSAL_RTOS_SUPPORT == THREADX_SUPPORT)
+#define OSAL_TASK_STATIC_WORDS      (96)   // TX_THREAD + notify event group + osal bookkeeping
+#define OSAL_QUEUE_STATIC_WORDS     (24)
+#define OSAL_SEMA_STATIC_WORDS      (16)
+#define OSAL_MUTEX_STATIC_WORDS     (24)
+#define OSAL_TIMER_STATIC_WORDS     (40)   // osal timer record + TX_TIMER
+#elif (OSAL_RTOS_SUPPORT == POSIX_SUPPORT)
+#define OSAL_TASK_STATIC_WORDS      (40)
+#define OSAL_QUEUE_STATIC_WORDS     (32)
+#define OSAL_SEMA_STATIC_WORDS      (8)
+#define OSAL_MUTEX_STATIC_WORDS     (8)
+#define OSAL_TIMER_STATIC_WORDS     (24)
+#else
+#define OSAL_TASK_STATIC_WORDS      (48)   // StaticTask_t
+#define OSAL_QUEUE_STATIC_WORDS     (24)   // StaticQueue_t
+#define OSAL_SEMA_STATIC_WORDS      (24)   // StaticSemaphore_t
+#define OSAL_MUTEX_STATIC_WORDS     (24)
+#define OSAL_TIMER_STATIC_WORDS     (32)   // osal timer record + StaticTimer_t
+#endif
+#endif // OSAL_TASK_STATIC_WORDS
+
+/* Declares the reserved array of a static storage type, 8-byte aligned for 64-bit kernel fields. */
+#define OSAL_STATIC_STORAGE(words) \
+    uint64_t reserved[((words) * sizeof(void *) + sizeof(uint64_t) - 1U) / sizeof(uint64_t)]
+
+#if (OSAL_RTOS_SUPPORT == POSIX_SUPPORT)
+/* The host port has no kernel config header to take the name length from. */
+#ifndef configMAX_TASK_NAME_LEN
+#define configMAX_TASK_NAME_LEN (16)
+#endif
+#endif
 
 
 #endif // __OSAL_CONFIG_H__
@@ -42,5 +42,6 @@
 #define OSAL_ERR_OUTPUT_TOO_LARGE        (41) /**< @brief Size of output exceeds limit  */
 #define OSAL_ERR_INVALID_ARGUMENT        (42) /**< @brief Invalid argument value (other than ID or size) */
 #define OSAL_ERR_IN_ISR                  (43) /**< @brief Currently in interrupt context */
+#define OSAL_ERR_DEADLINE_MISSED         (44) /**< @brief Wake time had already passed */
 
 #endif // __OSAL_ERROR_H__
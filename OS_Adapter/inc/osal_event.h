@@ -0,0 +1,35 @@
+#ifndef __OSAL_EVENT_H__
+#define __OSAL_EVENT_H__
+
+#include "common_types.h"
+
+/* FreeRTOS event groups carry 24 usable bits, the top byte is reserved on every backend. */
+#define OSAL_EVENT_BITS_MASK        (0x00FFFFFFUL)
+
+/* osal_event_wait() options */
+#define OSAL_EVENT_WAIT_ANY         (0x00U)   // return when any of the requested bits is set
+#define OSAL_EVENT_WAIT_ALL         (0x01U)   // return when all of the requested bits are set
+#define OSAL_EVENT_CLEAR_ON_EXIT    (0x02U)   // clear the requested bits when the wait succeeds
+
+int32_t osal_event_create(osal_event_handle_t *p_event_handle);
+
+int32_t osal_event_delete(osal_event_handle_t event_handle);
+
+/* ISR safe. */
+int32_t osal_event_set(osal_event_handle_t event_handle, osal_event_bits_t bits);
+
+/* ISR safe. */
+int32_t osal_event_clear(osal_event_handle_t event_handle, osal_event_bits_t bits);
+
+/**
+ * @brief Wait for bits of an event group, not callable from an ISR.
+ * @param p_bits Optional, receives the group value at the time the wait returned
+ *               (before CLEAR_ON_EXIT is applied).
+ * @return OSAL_SUCCESS when the condition was met, OSAL_ERROR_TIMEOUT otherwise.
+ */
+int32_t osal_event_wait(osal_event_handle_t event_handle, osal_event_bits_t bits, uint32_t options,
+                        osal_event_bits_t *p_bits, osal_tick_type_t timeout);
+
+osal_event_bits_t osal_event_get(osal_event_handle_t event_handle);
+
+#endif // __OSAL_EVENT_H__
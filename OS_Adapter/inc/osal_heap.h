@@ -3,8 +3,118 @@
 
 #include "common_types.h"
 
+typedef struct
+{
+    size_t total_size;            // bytes under management, 0 when the heap has no fixed size
+    size_t free_size;
+    size_t min_ever_free_size;    // low-water mark of free_size since boot
+    size_t largest_free_block;
+    uint32_t free_blocks;         // number of free fragments
+    uint32_t alloc_count;         // successful allocations
+    uint32_t free_count;
+    uint32_t failed_count;        // allocations that returned NULL
+} osal_heap_stats_t;
+
+#define OSAL_HEAP_TRACE_MALLOC      (0U)
+#define OSAL_HEAP_TRACE_FREE        (1U)
+
+typedef struct
+{
+    void *ptr;                  // NULL for a failed allocation
+    size_t size;                // requested size, for a free the size of the released allocation (0 if untracked)
+    void *caller;               // return address of the function that called the heap
+    osal_task_handle_t task;    // NULL from an ISR or before the scheduler runs
+    osal_tick_type_t tick;
+    uint32_t seq;               // event number, compare with osal_heap_trace_checkpoint()
+    uint32_t op;                // OSAL_HEAP_TRACE_MALLOC or OSAL_HEAP_TRACE_FREE
+} osal_heap_trace_record_t;
+
+/* Heap ids, OSAL_HEAP_REGION_DEFAULT is the heap behind osal_heap_malloc(). */
+typedef uint32_t osal_heap_region_t;
+
+#define OSAL_HEAP_REGION_DEFAULT    (0U)
+
+typedef void (*osal_heap_trace_cb_t)(const osal_heap_trace_record_t *p_record, void *arg);
+
+#define OSAL_HEAP_EVENT_LOW         (0U)    // free space fell below the watch threshold
+#define OSAL_HEAP_EVENT_FAILED      (1U)    // an allocation could not be served
+
+typedef void (*osal_heap_watch_cb_t)(uint32_t event, size_t size, void *arg);
+
+/**
+ * @brief Set up the heap and its interrupt side, once from startup code before the scheduler
+ * starts. Creates the ISR reserve and the low priority "osal_heap" task that releases blocks
+ * freed from interrupts. Without it the heap still sets itself up on first use, but
+ * osal_heap_malloc() returns NULL in an ISR and blocks freed there wait for the next heap
+ * call of a task.
+ */
+int32_t osal_heap_init(void);
+
+/* From an ISR only requests up to OSAL_HEAP_ISR_RESERVE_SIZE are served, from the reserve. */
 void* osal_heap_malloc(size_t wanted_size);
 
+/* Also releases blocks from osal_heap_malloc_aligned() and from region heaps. ISR safe, blocks are queued there. */
 void osal_heap_free(void *ptr);
 
+/* align is a power of two, e.g. OSAL_CACHE_LINE_SIZE for buffers a DMA engine writes. NULL from an ISR. */
+void *osal_heap_malloc_aligned(size_t wanted_size, size_t align);
+
+/**
+ * @brief Register memory as a named heap, e.g. DTCM or external SDRAM.
+ * Region heaps are run by the OSAL TLSF allocator on every kernel, at most
+ * OSAL_HEAP_REGION_MAX of them. osal_heap_free() recognises their blocks by address.
+ */
+int32_t osal_heap_region_add(const char *name, void *base, size_t size, osal_heap_region_t *p_region);
+
+int32_t osal_heap_region_find(const char *name, osal_heap_region_t *p_region);
+
+void *osal_heap_malloc_region(osal_heap_region_t region, size_t wanted_size);
+
+void *osal_heap_malloc_region_aligned(osal_heap_region_t region, size_t wanted_size, size_t align);
+
+int32_t osal_heap_region_get_stats(osal_heap_region_t region, osal_heap_stats_t *p_stats);
+
+/* Snapshot of the heap behind osal_heap_malloc(), for sizing OSAL_HEAP_POOL_SIZE from measurements. */
+int32_t osal_heap_get_stats(osal_heap_stats_t *p_stats);
+
+/**
+ * @brief Register a memory pressure callback, e.g. to shrink caches or shed load.
+ * OSAL_HEAP_EVENT_LOW fires once when a task's osal_heap_malloc() leaves less than threshold
+ * bytes free, size is the free byte count. It is armed again once a later osal_heap_malloc()
+ * or osal_heap_free() sees the heap back above the threshold (threshold 0: never).
+ * OSAL_HEAP_EVENT_FAILED fires for every failed allocation, the kernel's own ones included
+ * where it reports them, size is the request or 0 when unknown. Callbacks run in the
+ * allocating task, never in an ISR. They may free memory but should not allocate.
+ * Hosts without a fixed heap size only see OSAL_HEAP_EVENT_FAILED.
+ * @return OSAL_ERR_NO_FREE_IDS when OSAL_HEAP_WATCH_MAX callbacks are registered.
+ */
+int32_t osal_heap_watch_add(size_t threshold, osal_heap_watch_cb_t cb, void *arg);
+
+int32_t osal_heap_watch_remove(osal_heap_watch_cb_t cb, void *arg);
+
+/**
+ * @brief Give the blocks held by the calling task's cache back to the heap.
+ * Useful before reading heap stats or before a task ends by returning instead of
+ * osal_task_delete(). Does nothing without OSAL_HEAP_CACHE_ENABLE.
+ */
+void osal_heap_cache_flush(void);
+
+/*
+ * Allocation tracing, built with OSAL_HEAP_TRACE_ENABLE. Without it the checkpoint is always 0
+ * and the dumps return OSAL_ERR_NOT_IMPLEMENTED. Callbacks run outside the heap lock, records
+ * that change while a dump is in progress may be skipped.
+ */
+uint32_t osal_heap_trace_checkpoint(void);
+
+/* The last OSAL_HEAP_TRACE_DEPTH heap calls, oldest first. */
+int32_t osal_heap_trace_dump_log(osal_heap_trace_cb_t cb, void *arg);
+
+/**
+ * @brief Report allocations made between two checkpoints that are still outstanding.
+ * dump_live(0, osal_heap_trace_checkpoint(), ...) lists everything that is live.
+ * @return OSAL_ERR_NO_FREE_IDS when some allocations did not fit OSAL_HEAP_TRACE_LIVE_MAX
+ *         and could not be tracked, OSAL_SUCCESS otherwise.
+ */
+int32_t osal_heap_trace_dump_live(uint32_t from_checkpoint, uint32_t to_checkpoint, osal_heap_trace_cb_t cb, void *arg);
+
 #endif // __OSAL_HEAP_H__
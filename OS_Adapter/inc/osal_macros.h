@@ -3,7 +3,10 @@
 
 //#include <stdlib.h>
 #include <string.h>
+#include "osal_config.h"
+#if (OSAL_RTOS_SUPPORT != POSIX_SUPPORT)
 #include "cmsis_armcc.h"
+#endif
 /**
  * @brief Generic argument checking macro for non-critical values
  *
@@ -38,7 +41,13 @@
  */
 #define LENGTHCHECK(str, len, errcode) ARGCHECK(memchr(str, '\0', len), errcode)
 
+#if (OSAL_RTOS_SUPPORT == POSIX_SUPPORT)
+/* The host port has no IPSR, interrupt context is simulated per thread. */
+bool os_posix_is_in_isr(void);
+#define OSAL_IS_IN_ISR() (os_posix_is_in_isr())
+#else
 #define OSAL_IS_IN_ISR() (__get_IPSR() != 0U)
+#endif
 
 
 #endif // __OSAL_MACROS_H__
@@ -2,10 +2,18 @@
 #define __OSAL_MUTEX_H__
 
 #include "common_types.h"
+#include "osal_config.h"
 
+/* Caller provided control block for osal_mutex_create_static(). */
+typedef struct
+{
+    OSAL_STATIC_STORAGE(OSAL_MUTEX_STATIC_WORDS);
+} osal_mutex_static_t;
 
 int32_t osal_mutex_create(osal_mutex_handle_t *p_mutex_handle);
 
+int32_t osal_mutex_create_static(osal_mutex_handle_t *p_mutex_handle, osal_mutex_static_t *p_mutex_buffer);
+
 void osal_mutex_delete(osal_mutex_handle_t mutex_handle);
 
 int32_t osal_mutex_give(osal_mutex_handle_t mutex_handle);
@@ -0,0 +1,35 @@
+#ifndef __OSAL_POOL_H__
+#define __OSAL_POOL_H__
+
+#include "common_types.h"
+
+/*
+ * Fixed-size block pool
+ * Constant time alloc/free of equally sized blocks, no fragmentation. ThreadX uses a
+ * tx_block_pool, the other backends a lock-free freelist, so alloc and free are safe
+ * from interrupts everywhere. Blocks are aligned to 8 bytes.
+ */
+typedef struct
+{
+    size_t block_size;
+    uint32_t block_count;
+    uint32_t in_use;
+    uint32_t high_water;   // most blocks in use at the same time
+    uint32_t failures;     // allocations that returned NULL
+} osal_pool_stats_t;
+
+int32_t osal_pool_create(size_t block_size, uint32_t block_count, osal_pool_handle_t *p_pool_handle);
+
+int32_t osal_pool_delete(osal_pool_handle_t pool_handle);
+
+/* Waits up to timeout for a block to be freed, never blocks in an ISR. NULL when none is free. */
+void *osal_pool_alloc(osal_pool_handle_t pool_handle, osal_tick_type_t timeout);
+
+void *osal_pool_alloc_from_isr(osal_pool_handle_t pool_handle);
+
+/* ISR safe. */
+int32_t osal_pool_free(osal_pool_handle_t pool_handle, void *block);
+
+int32_t osal_pool_get_stats(osal_pool_handle_t pool_handle, osal_pool_stats_t *p_stats);
+
+#endif // __OSAL_POOL_H__
@@ -2,18 +2,67 @@
 #define __OSAL_QUEUE_H__
 
 #include "common_types.h"
+#include "osal_config.h"
+
+/* Caller provided control block for osal_queue_create_static(). */
+typedef struct
+{
+    OSAL_STATIC_STORAGE(OSAL_QUEUE_STATIC_WORDS);
+} osal_queue_static_t;
+
+/* Message storage needed by osal_queue_create_static(), ThreadX rounds messages up to whole words. */
+#define OSAL_QUEUE_STORAGE_SIZE(queue_depth, data_size) \
+    ((queue_depth) * ((((data_size) + sizeof(long) - 1U) / sizeof(long)) * sizeof(long)))
 
 int32_t osal_queue_create(size_t queue_depth, size_t data_size,osal_queue_handle_t *p_queue_handle);
 
+/**
+ * @brief Create a queue in caller provided memory, never allocates from the OSAL heap.
+ * storage must hold OSAL_QUEUE_STORAGE_SIZE(queue_depth, data_size) bytes, word aligned.
+ * Delete with osal_queue_delete(), the memory is not freed.
+ */
+int32_t osal_queue_create_static(size_t queue_depth, size_t data_size, osal_queue_handle_t *p_queue_handle,
+                                 void *storage, size_t storage_size, osal_queue_static_t *p_queue_buffer);
+
 int32_t osal_queue_delete(osal_queue_handle_t queue_handle);
 
 int32_t osal_queue_send(osal_queue_handle_t queue_handle, const void *data, osal_tick_type_t timeout);
-int32_t osal_queue_receive(osal_queue_handle_t queue_handle, const void *data, osal_tick_type_t timeout);
+int32_t osal_queue_receive(osal_queue_handle_t queue_handle, void *data, osal_tick_type_t timeout);
 
 int32_t osal_queue_peek(osal_queue_handle_t queue_handle);
 
 int32_t osal_queue_msg_waiting(osal_queue_handle_t queue_handle);
 
+/**
+ * @brief Batched send/receive of up to count messages of data_size bytes stored back to back.
+ * Only the first message may wait up to timeout, the rest are moved in the same scheduler
+ * section without blocking and waiters are woken once. Returns the number of messages moved,
+ * so a consumer can drain with a zero timeout until it returns 0. ISR safe (never blocks there).
+ */
+size_t osal_queue_send_many(osal_queue_handle_t queue_handle, const void *data, size_t data_size, size_t count, osal_tick_type_t timeout);
+
+size_t osal_queue_receive_many(osal_queue_handle_t queue_handle, void *data, size_t data_size, size_t count, osal_tick_type_t timeout);
+
+/**
+ * @brief Zero-copy (buffer loaning) queue.
+ * Messages are written and read in place in slots owned by the queue, only slot pointers
+ * go through the kernel queue. The producer loans a free slot, fills it and commits it;
+ * the consumer borrows the oldest committed slot and releases it when done.
+ * A loaned slot that will not be sent can be handed back with osal_queue_release().
+ * All calls may be used from interrupt context, where they never block.
+ */
+int32_t osal_queue_loan_create(size_t queue_depth, size_t data_size, osal_queue_handle_t *p_queue_handle);
+
+int32_t osal_queue_loan_delete(osal_queue_handle_t queue_handle);
+
+int32_t osal_queue_loan(osal_queue_handle_t queue_handle, void **pp_slot, osal_tick_type_t timeout);
+
+int32_t osal_queue_commit(osal_queue_handle_t queue_handle, void *p_slot);
+
+int32_t osal_queue_borrow(osal_queue_handle_t queue_handle, void **pp_slot, osal_tick_type_t timeout);
+
+int32_t osal_queue_release(osal_queue_handle_t queue_handle, void *p_slot);
+
 
 
 #endif // __OSAL_QUEUE_H__
@@ -0,0 +1,34 @@
+#ifndef __OSAL_RINGBUF_H__
+#define __OSAL_RINGBUF_H__
+
+#include "common_types.h"
+
+/*
+ * Lock-free ring buffer for ISR-to-task streaming.
+ * Capacity is a power of two, counted in elements of elem_size bytes.
+ * With a single producer and a single consumer no kernel lock is taken; MPSC serializes
+ * producers with a critical section. WAKE_SEMA lets osal_ringbuf_read_wait() block and
+ * is only given when the buffer goes from empty to non-empty.
+ */
+#define OSAL_RINGBUF_SPSC          (0x00U)
+#define OSAL_RINGBUF_MPSC          (0x01U)
+#define OSAL_RINGBUF_WAKE_SEMA     (0x02U)
+
+int32_t osal_ringbuf_create(size_t elem_size, size_t capacity, uint32_t flags, osal_ringbuf_handle_t *p_ringbuf_handle);
+
+int32_t osal_ringbuf_delete(osal_ringbuf_handle_t ringbuf_handle);
+
+/* Write up to count elements, returns the number written. */
+size_t osal_ringbuf_write(osal_ringbuf_handle_t ringbuf_handle, const void *data, size_t count);
+
+/* Read up to count elements, returns the number read. */
+size_t osal_ringbuf_read(osal_ringbuf_handle_t ringbuf_handle, void *data, size_t count);
+
+/* As osal_ringbuf_read(), but blocks up to timeout while the buffer is empty. Needs OSAL_RINGBUF_WAKE_SEMA. */
+size_t osal_ringbuf_read_wait(osal_ringbuf_handle_t ringbuf_handle, void *data, size_t count, osal_tick_type_t timeout);
+
+size_t osal_ringbuf_count(osal_ringbuf_handle_t ringbuf_handle);
+
+size_t osal_ringbuf_space(osal_ringbuf_handle_t ringbuf_handle);
+
+#endif // __OSAL_RINGBUF_H__
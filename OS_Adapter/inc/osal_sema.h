@@ -2,11 +2,23 @@
 #define __OSAL_SEMA_H__
 
 #include "common_types.h"
+#include "osal_config.h"
+
+/* Caller provided control block for the *_create_static() calls. */
+typedef struct
+{
+    OSAL_STATIC_STORAGE(OSAL_SEMA_STATIC_WORDS);
+} osal_sema_static_t;
 
 int32_t osal_sema_countings_create(osal_sema_handle_t *p_sema_handle, uint32_t max_count, uint32_t init_count);
 
 int32_t osal_sema_binary_create(osal_sema_handle_t *p_sema_handle);
 
+int32_t osal_sema_countings_create_static(osal_sema_handle_t *p_sema_handle, uint32_t max_count, uint32_t init_count,
+                                          osal_sema_static_t *p_sema_buffer);
+
+int32_t osal_sema_binary_create_static(osal_sema_handle_t *p_sema_handle, osal_sema_static_t *p_sema_buffer);
+
 void osal_sema_delete(osal_sema_handle_t sema_handle);
 
 int32_t osal_sema_give(osal_sema_handle_t sema_handle);
@@ -20,6 +20,14 @@ typedef void *osal_stackptr_t;
 // typedef void oasl_task;
 typedef void (*osal_task_entry)(void *);
 
+/* Caller provided control block for osal_task_create_static(). */
+typedef struct
+{
+    OSAL_STATIC_STORAGE(OSAL_TASK_STATIC_WORDS);
+} osal_task_static_t;
+
+#define OSAL_TASK_STACK_ALIGNMENT   (8U)
+
 /**
  * @brief Create a task ans starts running it.
  * Create a task and passes back the task id.
@@ -27,6 +35,38 @@ typedef void (*osal_task_entry)(void *);
 int32_t osal_task_create(const char *task_name, osal_task_entry func_pointer, size_t stack_size,
                          osal_priority_t priority, osal_task_handle_t *p_task_handle,void *argument);
 
+/**
+ * @brief Create a task in caller provided memory, never allocates from the OSAL heap.
+ * stack_buffer must be OSAL_TASK_STACK_ALIGNMENT aligned and stack_size is its size in bytes
+ * on every backend. Both buffers must stay valid until the task is deleted.
+ */
+int32_t osal_task_create_static(const char *task_name, osal_task_entry func_pointer, size_t stack_size,
+                                osal_priority_t priority, osal_task_handle_t *p_task_handle, void *argument,
+                                void *stack_buffer, osal_task_static_t *p_task_buffer);
+
+/*
+ * Core affinity on SMP kernels: FreeRTOS with configNUMBER_OF_CORES > 1 and
+ * configUSE_CORE_AFFINITY, ThreadX SMP, host CPUs on POSIX. Bit n allows core n, bits beyond
+ * osal_task_core_count() are ignored. Single core builds accept any mask that has bit 0.
+ */
+typedef uint32_t osal_core_mask_t;
+
+#define OSAL_CORE_MASK_ANY      ((osal_core_mask_t)0xFFFFFFFFU)
+#define OSAL_CORE_MASK(core)    ((osal_core_mask_t)1U << (core))
+
+/* Like osal_task_create(), the task only ever runs on the cores in core_mask, from its first instruction. */
+int32_t osal_task_create_affinity(const char *task_name, osal_task_entry func_pointer, size_t stack_size,
+                                  osal_priority_t priority, osal_core_mask_t core_mask,
+                                  osal_task_handle_t *p_task_handle, void *argument);
+
+/* NULL for the calling task, which moves before the call returns when its core is excluded. */
+int32_t osal_task_set_affinity(osal_task_handle_t task_handle, osal_core_mask_t core_mask);
+
+/* Core the caller runs on, it may migrate right after unless pinned or in a critical section. */
+uint32_t osal_task_get_core(void);
+
+uint32_t osal_task_core_count(void);
+
 /**
  * @brief Delete the current task.
  *
@@ -39,12 +79,43 @@ void osal_task_suspend(osal_task_handle_t osal_task_handle);
 
 void osal_task_resume(osal_task_handle_t osal_task_handle);
 
+/**
+ * @brief Keep other tasks from preempting the caller, interrupts stay enabled. Nests, the
+ * scheduler runs again at the unlock matching the first lock. Cheaper than a critical
+ * section for data that no ISR touches. The caller must not block while it holds the lock.
+ * On SMP kernels tasks on other cores keep running, use osal_enter_critical() or a mutex for
+ * data shared between cores. Task context only.
+ * @return OSAL_ERR_IN_ISR from an interrupt, unlock returns OSAL_ERR_INCORRECT_OBJ_STATE
+ *         when the caller holds no lock. OSAL_ERROR when the kernel cannot lock, e.g. ThreadX
+ *         built with TX_DISABLE_PREEMPTION_THRESHOLD.
+ */
+int32_t osal_sched_lock(void);
+
+int32_t osal_sched_unlock(void);
+
+/* Same as osal_sched_lock() and osal_sched_unlock(). */
 void osal_task_suspend_all(void);
 
+void osal_task_resume_all(void);
+
 void osal_task_delay(int32_t ticks);
 
 void osal_task_delay_ms(uint32_t ms);
 
+/**
+ * @brief Sleep until *p_last_wake + period ticks, then advance *p_last_wake by period.
+ * Set *p_last_wake from osal_task_get_tick_count() before the first call. Wake times stay on
+ * that grid, so a loop does not drift by its own run time.
+ * @return OSAL_SUCCESS, or OSAL_ERR_DEADLINE_MISSED without sleeping when the wake time had
+ *         already been reached, *p_last_wake is advanced either way.
+ */
+int32_t osal_task_delay_until(osal_tick_type_t *p_last_wake, osal_tick_type_t period);
+
+/*
+ * Excludes tasks and interrupts on every core, ThreadX SMP takes the kernel's inter-core lock
+ * and FreeRTOS SMP its task and ISR spinlocks. Nests. osal_task_disable_interrupts() only masks
+ * the calling core and does not protect data shared with other cores.
+ */
 uint32_t osal_enter_critical(void);
 
 void osal_exit_critical(uint32_t primask);
@@ -57,5 +128,123 @@ void osal_task_disable_interrupts(void);
 
 osal_tick_type_t osal_task_get_tick_count(void);
 
+/*
+ * Direct to task notifications
+ * Every task owns a 32-bit notification value, a lighter replacement for a semaphore or
+ * event group that has exactly one receiver. give and set_bits are ISR safe, take and wait
+ * act on the calling task and return OSAL_ERR_IN_ISR from an interrupt.
+ */
+int32_t osal_task_notify_give(osal_task_handle_t task_handle);
+
+/**
+ * @brief Wait for the notification value to become non-zero, counting semaphore style.
+ * @param clear_on_exit true resets the value to 0 (binary), false decrements it (counting).
+ * @param p_count Optional, receives the value before it was cleared or decremented.
+ * @return OSAL_SUCCESS or OSAL_ERROR_TIMEOUT.
+ */
+int32_t osal_task_notify_take(bool clear_on_exit, uint32_t *p_count, osal_tick_type_t timeout);
+
+int32_t osal_task_notify_set_bits(osal_task_handle_t task_handle, uint32_t bits);
+
+/**
+ * @brief Wait for any notification, event flags style.
+ * clear_on_entry bits are cleared unless a notification is already pending,
+ * clear_on_exit bits are cleared after the value has been copied to p_value.
+ * @return OSAL_SUCCESS or OSAL_ERROR_TIMEOUT.
+ */
+int32_t osal_task_notify_wait(uint32_t clear_on_entry, uint32_t clear_on_exit, uint32_t *p_value, osal_tick_type_t timeout);
+
+/*
+ * Task statistics
+ * CPU time comes from the kernel's own accounting: FreeRTOS run time stats
+ * (configGENERATE_RUN_TIME_STATS) or the ThreadX execution profile kit
+ * (TX_EXECUTION_PROFILE_ENABLE), thread CPU clocks on POSIX. Point the kernel at
+ * osal_task_stats_counter() so every backend counts in the same units:
+ *   FreeRTOS: portCONFIGURE_TIMER_FOR_RUN_TIME_STATS() osal_task_stats_counter_init()
+ *             portGET_RUN_TIME_COUNTER_VALUE()        osal_task_stats_counter()
+ *             configRUN_TIME_COUNTER_TYPE             uint64_t, 32 bits of cycles wrap in seconds
+ *   ThreadX:  TX_EXECUTION_TIME_SOURCE                 osal_task_stats_counter()
+ * FreeRTOS does not count context switches, with OSAL_TASK_SWITCH_COUNT_ENABLE set
+ * traceTASK_SWITCHED_IN() must call osal_task_switched_in().
+ */
+#define OSAL_TASK_STATE_RUNNING     (0U)
+#define OSAL_TASK_STATE_READY       (1U)
+#define OSAL_TASK_STATE_BLOCKED     (2U)
+#define OSAL_TASK_STATE_SUSPENDED   (3U)
+#define OSAL_TASK_STATE_DELETED     (4U)   // ended, waiting to be cleaned up
+
+#define OSAL_TASK_STATS_NAME_LEN    (16U)
+
+/* stack_free_min where the backend cannot measure it. */
+#define OSAL_TASK_STACK_UNKNOWN     (SIZE_MAX)
+
+typedef struct
+{
+    osal_task_handle_t handle;
+    char name[OSAL_TASK_STATS_NAME_LEN];
+    uint32_t state;             // OSAL_TASK_STATE_*
+    osal_priority_t priority;
+    size_t stack_size;          // bytes, 0 when the kernel does not record it
+    size_t stack_free_min;      // bytes of stack never used so far (high-water mark)
+    uint64_t run_time;          // CPU time in osal_task_stats_counter() units, 0 without kernel accounting
+    uint32_t switch_count;      // times the task was switched in, 0 when not counted
+} osal_task_stats_t;
+
+/* NULL for the calling task. Not callable from an ISR, scanning a stack takes a while. */
+int32_t osal_task_get_stats(osal_task_handle_t task_handle, osal_task_stats_t *p_stats);
+
+/**
+ * @brief Statistics of every task the kernel knows, the OSAL's own and kernel tasks included.
+ * @param p_total_run_time Optional, receives the run time of the whole system in the same
+ *        units as run_time, for CPU shares (0 without kernel accounting).
+ * @return Entries written, at most max_count.
+ */
+size_t osal_task_list_stats(osal_task_stats_t *p_stats, size_t max_count, uint64_t *p_total_run_time);
+
+/*
+ * Free running 64-bit counter, DWT cycles on Cortex-M3 and up, else osal_time_now_us(). Cycles
+ * are extended to 64 bits in software, it has to be read once per 2^32 cycles, which the
+ * context switches do. POSIX takes run times from the host kernel in microseconds.
+ */
+void osal_task_stats_counter_init(void);
+
+uint64_t osal_task_stats_counter(void);
+
+/* FreeRTOS only, for traceTASK_SWITCHED_IN() when OSAL_TASK_SWITCH_COUNT_ENABLE is set. */
+void osal_task_switched_in(void);
+
+/*
+ * Periodic tasks
+ * A task that calls cb every period ticks on a fixed grid. When a run ends past the next
+ * release time the missed releases are dropped and the grid restarts from that moment,
+ * so an overrun never causes a burst of back-to-back runs. Times are measured with
+ * osal_time_now_us(), at kernel tick resolution on the RTOS backends.
+ */
+typedef void (*osal_periodic_cb_t)(void *arg);
+
+typedef struct
+{
+    uint32_t runs;            // callbacks completed
+    uint32_t missed;          // overruns, each drops the releases that had passed
+    uint32_t exec_last_us;    // run time of the last callback
+    uint32_t exec_max_us;
+    uint32_t late_last_us;    // start of the last callback after its release time
+    uint32_t late_max_us;
+} osal_periodic_stats_t;
+
+int32_t osal_periodic_task_create(const char *task_name, osal_periodic_cb_t cb, void *arg, osal_tick_type_t period,
+                                  size_t stack_size, osal_priority_t priority, osal_periodic_handle_t *p_periodic_handle);
+
+/*
+ * The task ends once the callback returns when called from it, otherwise at its next release,
+ * at most one period later. The handle is invalid as soon as this returns.
+ */
+int32_t osal_periodic_task_delete(osal_periodic_handle_t periodic_handle);
+
+int32_t osal_periodic_task_get_stats(osal_periodic_handle_t periodic_handle, osal_periodic_stats_t *p_stats);
+
+/* Restart the maxima and counters, e.g. after start-up. */
+int32_t osal_periodic_task_reset_stats(osal_periodic_handle_t periodic_handle);
+
 
 #endif // __OSAL_TASK_H__
@@ -0,0 +1,40 @@
+#ifndef __OSAL_TIME_H__
+#define __OSAL_TIME_H__
+
+#include "common_types.h"
+
+/*
+ * Units. Every timeout and timer period the OSAL takes is in milliseconds, whatever the
+ * kernel tick rate, OSAL_MAX_DELAY waits forever. Only osal_task_delay(),
+ * osal_task_get_tick_count(), and the periods of osal_task_delay_until() and
+ * osal_periodic_task_create() work in kernel ticks, so a periodic grid never drifts.
+ */
+typedef uint32_t osal_time_ms_t;
+typedef uint64_t osal_time_us_t;
+
+/**
+ * @brief Monotonic time since the kernel started, never wraps. ISR safe.
+ * Resolution is one kernel tick on the RTOS backends.
+ */
+osal_time_us_t osal_time_now_us(void);
+
+uint32_t osal_time_tick_rate_hz(void);
+
+/* Rounds up so a wait never ends early, OSAL_MAX_DELAY stays OSAL_MAX_DELAY and longer waits saturate below it. */
+osal_tick_type_t osal_time_ms_to_ticks(osal_time_ms_t ms);
+
+osal_time_ms_t osal_time_ticks_to_ms(osal_tick_type_t ticks);
+
+/* Ticks from start to end, two osal_task_get_tick_count() values, correct across a wrap. */
+static inline osal_tick_type_t osal_time_ticks_diff(osal_tick_type_t end, osal_tick_type_t start)
+{
+    return (osal_tick_type_t)(end - start);
+}
+
+/* True once now has reached deadline, for deadlines set less than half the tick range ahead. */
+static inline bool osal_time_ticks_reached(osal_tick_type_t now, osal_tick_type_t deadline)
+{
+    return (osal_tick_type_t)(now - deadline) <= (osal_tick_type_t)(OSAL_MAX_DELAY / 2U);
+}
+
+#endif // __OSAL_TIME_H__
@@ -2,11 +2,21 @@
 #define __OSAL_TIMER_H__
 
 #include "common_types.h"
+#include "osal_config.h"
 
 typedef void (*osal_timer_cb_function_t)(osal_timer_handle_t timer_handle, void *);
 
+/* Caller provided memory for osal_timer_create_static(), holds the osal record and the kernel timer. */
+typedef struct
+{
+    OSAL_STATIC_STORAGE(OSAL_TIMER_STATIC_WORDS);
+} osal_timer_static_t;
+
 int32_t osal_timer_create(osal_timer_handle_t *timer_handle, const char *timer_name, osal_tick_type_t timer_period, uint8_t auto_reload, osal_timer_cb_function_t timer_cb, void *arg);
 
+int32_t osal_timer_create_static(osal_timer_handle_t *timer_handle, const char *timer_name, osal_tick_type_t timer_period, uint8_t auto_reload, osal_timer_cb_function_t timer_cb, void *arg,
+                                 osal_timer_static_t *p_timer_buffer);
+
 int32_t osal_timer_start(osal_timer_handle_t timer_handle, osal_tick_type_t ticks_to_wait);
 
 int32_t osal_timer_stop(osal_timer_handle_t timer_handle, osal_tick_type_t ticks_to_wait);
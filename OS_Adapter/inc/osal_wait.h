@@ -0,0 +1,28 @@
+#ifndef __OSAL_WAIT_H__
+#define __OSAL_WAIT_H__
+
+#include "common_types.h"
+
+/*
+ * Multi-object wait (queue set).
+ * A task blocks on several queues and semaphores at once. Every message sent to a member
+ * queue and every give of a member semaphore posts one event; osal_wait_any() returns the
+ * member of the oldest event, which the caller then receives from or takes with a zero timeout.
+ * max_events must cover the sum of all member depths (1 per binary semaphore).
+ * Members must be empty when added and belong to at most one set.
+ * osal_wait_set_delete() detaches the remaining members; on FreeRTOS it fails with
+ * OSAL_ERR_OBJECT_IN_USE while one of them still holds data.
+ */
+int32_t osal_wait_set_create(size_t max_events, osal_wait_set_handle_t *p_set_handle);
+
+int32_t osal_wait_set_delete(osal_wait_set_handle_t set_handle);
+
+int32_t osal_wait_set_add_queue(osal_wait_set_handle_t set_handle, osal_queue_handle_t queue_handle);
+
+int32_t osal_wait_set_add_sema(osal_wait_set_handle_t set_handle, osal_sema_handle_t sema_handle);
+
+int32_t osal_wait_set_remove(osal_wait_set_handle_t set_handle, void *member_handle);
+
+int32_t osal_wait_any(osal_wait_set_handle_t set_handle, void **p_ready_handle, osal_tick_type_t timeout);
+
+#endif // __OSAL_WAIT_H__
@@ -0,0 +1,63 @@
+#ifndef __OSAL_WORKQUEUE_H__
+#define __OSAL_WORKQUEUE_H__
+
+#include "common_types.h"
+#include "osal_time.h"
+#include "osal_task.h"
+
+/*
+ * Work queue
+ * A few shared worker tasks that run short jobs deferred from drivers and interrupts, instead
+ * of a task and a semaphore per driver. Work items are embedded in the caller's own structures
+ * and initialised once, submitting never allocates. A worker that finds more work queued keeps
+ * running it without blocking, and wakes an idle colleague only while work is left over.
+ */
+typedef void (*osal_work_fn_t)(void *arg);
+
+/* Members are private, set up with osal_work_init() and keep it alive while it is queued. */
+typedef struct osal_work
+{
+    struct osal_work *next;
+    osal_work_fn_t fn;
+    void *arg;
+    osal_workqueue_handle_t wq;    // queue it was last submitted to
+    osal_tick_type_t due;          // tick count a delayed work becomes ready
+    volatile uint32_t state;
+} osal_work_t;
+
+/**
+ * @brief Start n_workers tasks named task_name that run submitted work in FIFO order.
+ * Work on one queue runs in parallel when n_workers > 1, use one worker to serialise it.
+ */
+int32_t osal_workqueue_create(const char *task_name, uint32_t n_workers, osal_priority_t priority, size_t stack_size,
+                              osal_workqueue_handle_t *p_wq_handle);
+
+/**
+ * @brief Stop the workers. Queued work is dropped and can be submitted again elsewhere, work
+ * that is running finishes first, the workers then exit and free the queue on their own.
+ * May be called from one of the queue's own work functions.
+ */
+int32_t osal_workqueue_delete(osal_workqueue_handle_t wq_handle);
+
+void osal_work_init(osal_work_t *p_work, osal_work_fn_t fn, void *arg);
+
+/**
+ * @brief Queue work to run once. A work that is already queued stays queued once, so a burst
+ * of submissions from an interrupt runs it once. A running work may submit itself again.
+ * @return OSAL_ERR_OBJECT_IN_USE while it is queued on another queue.
+ */
+int32_t osal_work_submit(osal_workqueue_handle_t wq_handle, osal_work_t *p_work);
+
+int32_t osal_work_submit_from_isr(osal_workqueue_handle_t wq_handle, osal_work_t *p_work);
+
+/* Queue work after delay_ms, ISR safe. A work that is already queued keeps its place and delay. */
+int32_t osal_work_submit_delayed(osal_workqueue_handle_t wq_handle, osal_work_t *p_work, osal_time_ms_t delay_ms);
+
+/**
+ * @brief Take work off its queue. ISR safe, and only while that queue exists.
+ * @return OSAL_SUCCESS when the work is neither queued nor running any more,
+ *         OSAL_ERR_OBJECT_IN_USE when a worker is running its function right now.
+ */
+int32_t osal_work_cancel(osal_work_t *p_work);
+
+#endif // __OSAL_WORKQUEUE_H__
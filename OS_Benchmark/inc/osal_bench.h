@@ -0,0 +1,68 @@
+#ifndef __OSAL_BENCH_H__
+#define __OSAL_BENCH_H__
+
+#include "osal.h"
+
+/*
+ * OSAL micro-benchmark suite
+ * Uses the public osal.h API only, so the same sources run on every backend
+ * (FreeRTOS GCC/Posix port, ThreadX Linux port, OS_Implementation/POSIX, targets).
+ * All benchmark tasks share one priority, which keeps the numbers comparable between
+ * kernels that order priorities differently.
+ */
+
+#ifndef OSAL_BENCH_TASK_PRIORITY
+#define OSAL_BENCH_TASK_PRIORITY    (2)
+#endif
+
+#ifndef OSAL_BENCH_STACK_SIZE
+#define OSAL_BENCH_STACK_SIZE       (4096)
+#endif
+
+/* Timed iterations per benchmark, also the size of the sample buffer. */
+#ifndef OSAL_BENCH_ITERATIONS
+#define OSAL_BENCH_ITERATIONS       (2000)
+#endif
+
+#ifndef OSAL_BENCH_TIMER_SAMPLES
+#define OSAL_BENCH_TIMER_SAMPLES    (100)
+#endif
+
+#ifndef OSAL_BENCH_TIMER_PERIOD
+#define OSAL_BENCH_TIMER_PERIOD     (5)   // unit:ms
+#endif
+
+/* Only used to convert to ns on targets without a hosted clock. */
+#ifndef OSAL_BENCH_TICK_RATE_HZ
+#define OSAL_BENCH_TICK_RATE_HZ     (1000U)
+#endif
+
+typedef struct
+{
+    const char *name;
+    uint32_t samples;
+    uint64_t min;     // unit:cycles
+    uint64_t median;
+    uint64_t p99;
+    uint64_t max;
+} osal_bench_result_t;
+
+/**
+ * @brief Create the benchmark runner task.
+ * Call before osal_task_start(). The runner prints one line per result and, on hosted
+ * builds, exits the process when done.
+ */
+int32_t osal_bench_start(void);
+
+/**
+ * @brief Free running cycle counter used for all measurements.
+ * TSC on x86, CNTVCT on AArch64, DWT->CYCCNT on Cortex-M, CLOCK_MONOTONIC ns otherwise.
+ */
+uint64_t osal_bench_cycles(void);
+
+void osal_bench_clock_init(void);
+
+/* Reference clock for calibration, 0 when the platform has none besides the OSAL tick. */
+uint64_t osal_bench_ref_ns(void);
+
+#endif // __OSAL_BENCH_H__
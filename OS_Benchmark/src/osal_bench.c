@@ -0,0 +1,460 @@
+#include "osal_bench.h"
+#include <stdio.h>
+#include <stdlib.h>
+
+#define BENCH_MAX_MSG_SIZE  (1024)
+
+typedef struct
+{
+    osal_sema_handle_t ping;
+    osal_sema_handle_t pong;
+    osal_sema_handle_t done;
+    osal_mutex_handle_t mutex;
+    osal_queue_handle_t queue;
+    size_t msg_size;
+    uint32_t iterations;
+    volatile uint32_t stop;
+    volatile uint32_t timer_count;
+} osal_bench_ctx_t;
+
+static osal_bench_ctx_t bench;
+static uint64_t bench_samples[OSAL_BENCH_ITERATIONS];
+static uint64_t bench_timer_stamps[OSAL_BENCH_TIMER_SAMPLES];
+static uint8_t bench_tx_msg[BENCH_MAX_MSG_SIZE];
+static uint8_t bench_rx_msg[BENCH_MAX_MSG_SIZE];
+
+static uint64_t bench_overhead;       // cost of one back-to-back osal_bench_cycles() pair
+static double bench_ns_per_cycle;
+static uint64_t bench_cycles_per_tick;
+
+static int bench_cmp_u64(const void *a, const void *b)
+{
+    uint64_t x = *(const uint64_t *)a;
+    uint64_t y = *(const uint64_t *)b;
+    return (x > y) - (x < y);
+}
+
+static void bench_report(const char *name, uint64_t *samples, uint32_t count)
+{
+    osal_bench_result_t r;
+    uint32_t i;
+
+    for (i = 0; i < count; i++)
+    {
+        samples[i] = (samples[i] > bench_overhead) ? (samples[i] - bench_overhead) : 0;
+    }
+    qsort(samples, count, sizeof(uint64_t), bench_cmp_u64);
+
+    r.name = name;
+    r.samples = count;
+    r.min = samples[0];
+    r.median = samples[count / 2];
+    r.p99 = samples[(count * 99U) / 100U];
+    r.max = samples[count - 1];
+
+    printf("%-28s n=%-5u cycles min/med/p99/max %8llu %8llu %8llu %10llu | ns %8.0f %8.0f %8.0f %10.0f\n",
+           r.name, (unsigned)r.samples,
+           (unsigned long long)r.min, (unsigned long long)r.median,
+           (unsigned long long)r.p99, (unsigned long long)r.max,
+           r.min * bench_ns_per_cycle, r.median * bench_ns_per_cycle,
+           r.p99 * bench_ns_per_cycle, r.max * bench_ns_per_cycle);
+}
+
+static void bench_calibrate(void)
+{
+    uint32_t i;
+    uint64_t best = UINT64_MAX;
+
+    osal_bench_clock_init();
+    for (i = 0; i < 1000U; i++)
+    {
+        uint64_t t0 = osal_bench_cycles();
+        uint64_t t1 = osal_bench_cycles();
+        if (t1 - t0 < best)
+        {
+            best = t1 - t0;
+        }
+    }
+    bench_overhead = best;
+
+    /* Align on a tick edge, then time 100 ticks against both clocks. */
+    osal_task_delay(1);
+    osal_tick_type_t k0 = osal_task_get_tick_count();
+    uint64_t c0 = osal_bench_cycles();
+    uint64_t n0 = osal_bench_ref_ns();
+    osal_task_delay(100);
+    osal_tick_type_t k1 = osal_task_get_tick_count();
+    uint64_t c1 = osal_bench_cycles();
+    uint64_t n1 = osal_bench_ref_ns();
+
+    osal_tick_type_t ticks = (osal_tick_type_t)(k1 - k0);
+    if (ticks == 0)
+    {
+        ticks = 1;
+    }
+    bench_cycles_per_tick = (c1 - c0) / ticks;
+    if (n1 > n0)
+    {
+        bench_ns_per_cycle = (double)(n1 - n0) / (double)(c1 - c0);
+    }
+    else
+    {
+        bench_ns_per_cycle = (1e9 / OSAL_BENCH_TICK_RATE_HZ) / (double)bench_cycles_per_tick;
+    }
+
+    printf("osal_bench: %.3f ns/cycle, %llu cycles/tick, timer overhead %llu cycles\n",
+           bench_ns_per_cycle, (unsigned long long)bench_cycles_per_tick, (unsigned long long)bench_overhead);
+}
+
+/* ---------------------------------------------------------------- sema ping-pong */
+
+static void bench_pong_task(void *arg)
+{
+    uint32_t i;
+    for (i = 0; i < bench.iterations; i++)
+    {
+        osal_sema_take(bench.ping, OSAL_MAX_DELAY);
+        osal_sema_give(bench.pong);
+    }
+    osal_sema_give(bench.done);
+    osal_task_delete(NULL);
+}
+
+static void bench_sema_ping_pong(void)
+{
+    uint32_t i;
+
+    bench.iterations = OSAL_BENCH_ITERATIONS;
+    osal_sema_binary_create(&bench.ping);
+    osal_sema_binary_create(&bench.pong);
+    osal_task_create("bench_pong", bench_pong_task, OSAL_BENCH_STACK_SIZE, OSAL_BENCH_TASK_PRIORITY, NULL, NULL);
+
+    for (i = 0; i < bench.iterations; i++)
+    {
+        uint64_t t0 = osal_bench_cycles();
+        osal_sema_give(bench.ping);
+        osal_sema_take(bench.pong, OSAL_MAX_DELAY);
+        bench_samples[i] = osal_bench_cycles() - t0;
+    }
+    osal_sema_take(bench.done, OSAL_MAX_DELAY);
+    bench_report("sema ping-pong round trip", bench_samples, bench.iterations);
+
+    osal_sema_delete(bench.ping);
+    osal_sema_delete(bench.pong);
+}
+
+/* ---------------------------------------------------------------- mutex */
+
+static void bench_mutex_contender_task(void *arg)
+{
+    uint32_t i;
+    for (i = 0; i < bench.iterations; i++)
+    {
+        osal_mutex_take(bench.mutex, OSAL_MAX_DELAY);
+        osal_port_yield();
+        osal_mutex_give(bench.mutex);
+        osal_port_yield();
+    }
+    osal_sema_give(bench.done);
+    osal_task_delete(NULL);
+}
+
+static void bench_mutex(void)
+{
+    uint32_t i;
+
+    bench.iterations = OSAL_BENCH_ITERATIONS;
+    osal_mutex_create(&bench.mutex);
+
+    for (i = 0; i < bench.iterations; i++)
+    {
+        uint64_t t0 = osal_bench_cycles();
+        osal_mutex_take(bench.mutex, OSAL_MAX_DELAY);
+        osal_mutex_give(bench.mutex);
+        bench_samples[i] = osal_bench_cycles() - t0;
+    }
+    bench_report("mutex take+give uncontended", bench_samples, bench.iterations);
+
+    osal_task_create("bench_mtx", bench_mutex_contender_task, OSAL_BENCH_STACK_SIZE, OSAL_BENCH_TASK_PRIORITY, NULL, NULL);
+    for (i = 0; i < bench.iterations; i++)
+    {
+        uint64_t t0 = osal_bench_cycles();
+        osal_mutex_take(bench.mutex, OSAL_MAX_DELAY);
+        osal_mutex_give(bench.mutex);
+        bench_samples[i] = osal_bench_cycles() - t0;
+        osal_port_yield();
+    }
+    osal_sema_take(bench.done, OSAL_MAX_DELAY);
+    bench_report("mutex take+give contended", bench_samples, bench.iterations);
+
+    osal_mutex_delete(bench.mutex);
+}
+
+/* ---------------------------------------------------------------- queue throughput */
+
+static void bench_queue_consumer_task(void *arg)
+{
+    uint32_t i;
+    for (i = 0; i < bench.iterations; i++)
+    {
+        osal_queue_receive(bench.queue, bench_rx_msg, OSAL_MAX_DELAY);
+    }
+    osal_sema_give(bench.done);
+    osal_task_delete(NULL);
+}
+
+static void bench_queue_throughput(size_t msg_size, size_t depth)
+{
+    uint32_t i;
+    char name[40];
+
+    bench.iterations = OSAL_BENCH_ITERATIONS;
+    bench.msg_size = msg_size;
+    if (osal_queue_create(depth, msg_size, &bench.queue) != OSAL_SUCCESS)
+    {
+        printf("queue %4u B x %3u: create failed\n", (unsigned)msg_size, (unsigned)depth);
+        return;
+    }
+    osal_task_create("bench_qrx", bench_queue_consumer_task, OSAL_BENCH_STACK_SIZE, OSAL_BENCH_TASK_PRIORITY, NULL, NULL);
+
+    uint64_t start = osal_bench_cycles();
+    for (i = 0; i < bench.iterations; i++)
+    {
+        uint64_t t0 = osal_bench_cycles();
+        osal_queue_send(bench.queue, bench_tx_msg, OSAL_MAX_DELAY);
+        bench_samples[i] = osal_bench_cycles() - t0;
+    }
+    osal_sema_take(bench.done, OSAL_MAX_DELAY);
+    uint64_t total = osal_bench_cycles() - start;
+
+    snprintf(name, sizeof(name), "queue send %4uB x%-3u", (unsigned)msg_size, (unsigned)depth);
+    bench_report(name, bench_samples, bench.iterations);
+    printf("%-28s %.0f msg/s, %.1f MB/s\n", "",
+           bench.iterations / (total * bench_ns_per_cycle * 1e-9),
+           (bench.iterations * (double)msg_size) / (total * bench_ns_per_cycle * 1e-3));
+
+    osal_queue_delete(bench.queue);
+}
+
+static void bench_loan_consumer_task(void *arg)
+{
+    uint32_t i;
+    void *p_slot;
+    for (i = 0; i < bench.iterations; i++)
+    {
+        osal_queue_borrow(bench.queue, &p_slot, OSAL_MAX_DELAY);
+        osal_queue_release(bench.queue, p_slot);
+    }
+    osal_sema_give(bench.done);
+    osal_task_delete(NULL);
+}
+
+/* Same traffic as bench_queue_throughput() through the zero-copy API, the producer fills the slot in place. */
+static void bench_queue_loan_throughput(size_t msg_size, size_t depth)
+{
+    uint32_t i;
+    void *p_slot;
+    char name[40];
+
+    bench.iterations = OSAL_BENCH_ITERATIONS;
+    if (osal_queue_loan_create(depth, msg_size, &bench.queue) != OSAL_SUCCESS)
+    {
+        printf("loan queue %4u B x %3u: create failed\n", (unsigned)msg_size, (unsigned)depth);
+        return;
+    }
+    osal_task_create("bench_lrx", bench_loan_consumer_task, OSAL_BENCH_STACK_SIZE, OSAL_BENCH_TASK_PRIORITY, NULL, NULL);
+
+    uint64_t start = osal_bench_cycles();
+    for (i = 0; i < bench.iterations; i++)
+    {
+        uint64_t t0 = osal_bench_cycles();
+        osal_queue_loan(bench.queue, &p_slot, OSAL_MAX_DELAY);
+        memset(p_slot, (int)i, msg_size);
+        osal_queue_commit(bench.queue, p_slot);
+        bench_samples[i] = osal_bench_cycles() - t0;
+    }
+    osal_sema_take(bench.done, OSAL_MAX_DELAY);
+    uint64_t total = osal_bench_cycles() - start;
+
+    snprintf(name, sizeof(name), "queue loan %4uB x%-3u", (unsigned)msg_size, (unsigned)depth);
+    bench_report(name, bench_samples, bench.iterations);
+    printf("%-28s %.0f msg/s, %.1f MB/s\n", "",
+           bench.iterations / (total * bench_ns_per_cycle * 1e-9),
+           (bench.iterations * (double)msg_size) / (total * bench_ns_per_cycle * 1e-3));
+
+    osal_queue_loan_delete(bench.queue);
+}
+
+#define BENCH_BATCH (16U)
+
+static void bench_batch_consumer_task(void *arg)
+{
+    uint32_t received = 0;
+    while (received < bench.iterations * BENCH_BATCH)
+    {
+        received += osal_queue_receive_many(bench.queue, bench_rx_msg, bench.msg_size, BENCH_MAX_MSG_SIZE / bench.msg_size, OSAL_MAX_DELAY);
+    }
+    osal_sema_give(bench.done);
+    osal_task_delete(NULL);
+}
+
+/* BENCH_BATCH messages per osal_queue_send_many() call, drained in bulk by the consumer. */
+static void bench_queue_batch_throughput(size_t msg_size, size_t depth)
+{
+    uint32_t i;
+    char name[40];
+
+    bench.iterations = OSAL_BENCH_ITERATIONS;
+    bench.msg_size = msg_size;
+    if (osal_queue_create(depth, msg_size, &bench.queue) != OSAL_SUCCESS)
+    {
+        printf("batch queue %4u B x %3u: create failed\n", (unsigned)msg_size, (unsigned)depth);
+        return;
+    }
+    osal_task_create("bench_brx", bench_batch_consumer_task, OSAL_BENCH_STACK_SIZE, OSAL_BENCH_TASK_PRIORITY, NULL, NULL);
+
+    uint64_t start = osal_bench_cycles();
+    for (i = 0; i < bench.iterations; i++)
+    {
+        size_t sent = 0;
+        uint64_t t0 = osal_bench_cycles();
+        while (sent < BENCH_BATCH)
+        {
+            sent += osal_queue_send_many(bench.queue, &bench_tx_msg[sent * msg_size], msg_size, BENCH_BATCH - sent, OSAL_MAX_DELAY);
+        }
+        bench_samples[i] = osal_bench_cycles() - t0;
+    }
+    osal_sema_take(bench.done, OSAL_MAX_DELAY);
+    uint64_t total = osal_bench_cycles() - start;
+
+    snprintf(name, sizeof(name), "queue batch %3uB x%-3u x16", (unsigned)msg_size, (unsigned)depth);
+    bench_report(name, bench_samples, bench.iterations);
+    printf("%-28s %.0f msg/s\n", "", (bench.iterations * BENCH_BATCH) / (total * bench_ns_per_cycle * 1e-9));
+
+    osal_queue_delete(bench.queue);
+}
+
+/* ---------------------------------------------------------------- task switch */
+
+static void bench_yield_task(void *arg)
+{
+    while (bench.stop == 0U)
+    {
+        osal_port_yield();
+    }
+    osal_sema_give(bench.done);
+    osal_task_delete(NULL);
+}
+
+static void bench_task_switch(void)
+{
+    uint32_t i;
+
+    bench.iterations = OSAL_BENCH_ITERATIONS;
+    bench.stop = 0U;
+    osal_task_create("bench_yld", bench_yield_task, OSAL_BENCH_STACK_SIZE, OSAL_BENCH_TASK_PRIORITY, NULL, NULL);
+    osal_port_yield();
+
+    /* One yield round trip is two switches when the peer is ready. */
+    for (i = 0; i < bench.iterations; i++)
+    {
+        uint64_t t0 = osal_bench_cycles();
+        osal_port_yield();
+        bench_samples[i] = (osal_bench_cycles() - t0) / 2U;
+    }
+    bench.stop = 1U;
+    osal_sema_take(bench.done, OSAL_MAX_DELAY);
+    bench_report("task switch (yield / 2)", bench_samples, bench.iterations);
+}
+
+/* ---------------------------------------------------------------- timer jitter */
+
+static void bench_timer_cb(osal_timer_handle_t timer_handle, void *arg)
+{
+    uint32_t n = bench.timer_count;
+    if (n < OSAL_BENCH_TIMER_SAMPLES)
+    {
+        bench_timer_stamps[n] = osal_bench_cycles();
+        bench.timer_count = n + 1U;
+        if (n + 1U == OSAL_BENCH_TIMER_SAMPLES)
+        {
+            osal_sema_give(bench.done);
+        }
+    }
+}
+
+static void bench_timer_jitter(void)
+{
+    osal_timer_handle_t timer;
+    uint32_t i;
+    uint64_t expected = bench_cycles_per_tick * osal_time_ms_to_ticks(OSAL_BENCH_TIMER_PERIOD);
+
+    bench.timer_count = 0U;
+    if (osal_timer_create(&timer, "bench_tmr", OSAL_BENCH_TIMER_PERIOD, 1, bench_timer_cb, NULL) != OSAL_SUCCESS)
+    {
+        printf("timer create failed\n");
+        return;
+    }
+    osal_timer_start(timer, OSAL_BENCH_TIMER_PERIOD);
+    osal_sema_take(bench.done, OSAL_MAX_DELAY);
+    osal_timer_stop(timer, OSAL_MAX_DELAY);
+    osal_timer_delete(timer, OSAL_MAX_DELAY);
+
+    for (i = 1; i < OSAL_BENCH_TIMER_SAMPLES; i++)
+    {
+        uint64_t interval = bench_timer_stamps[i] - bench_timer_stamps[i - 1U];
+        /* Jitter around the calibrated period, overhead is added back since bench_report() removes it. */
+        bench_samples[i - 1U] = ((interval > expected) ? (interval - expected) : (expected - interval)) + bench_overhead;
+    }
+    bench_report("timer period jitter", bench_samples, OSAL_BENCH_TIMER_SAMPLES - 1U);
+}
+
+/* ---------------------------------------------------------------- runner */
+
+static void osal_bench_runner(void *arg)
+{
+    static const size_t msg_sizes[] = {4, 16, 64, 256, 1024};
+    static const size_t depths[] = {1, 8, 64};
+    uint32_t s;
+    uint32_t d;
+
+    bench_calibrate();
+
+    bench_sema_ping_pong();
+    bench_mutex();
+    for (s = 0; s < sizeof(msg_sizes) / sizeof(msg_sizes[0]); s++)
+    {
+        for (d = 0; d < sizeof(depths) / sizeof(depths[0]); d++)
+        {
+            bench_queue_throughput(msg_sizes[s], depths[d]);
+        }
+    }
+    bench_queue_batch_throughput(16, 64);
+    bench_queue_loan_throughput(256, 8);
+    bench_queue_loan_throughput(1024, 8);
+    bench_task_switch();
+    bench_timer_jitter();
+
+    printf("osal_bench: done\n");
+    fflush(stdout);
+#if defined(__linux__) || defined(__unix__) || defined(__APPLE__)
+    exit(0);
+#else
+    for (;;)
+    {
+        osal_task_delay(OSAL_MAX_DELAY);
+    }
+#endif
+}
+
+int32_t osal_bench_start(void)
+{
+    int32_t ret;
+
+    ret = osal_sema_countings_create(&bench.done, 1, 0);
+    if (ret == OSAL_SUCCESS)
+    {
+        ret = osal_task_create("bench_run", osal_bench_runner, OSAL_BENCH_STACK_SIZE, OSAL_BENCH_TASK_PRIORITY, NULL, NULL);
+    }
+    return ret;
+}
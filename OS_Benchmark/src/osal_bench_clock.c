@@ -0,0 +1,66 @@
+#include "osal_bench.h"
+
+#if defined(__linux__) || defined(__unix__) || defined(__APPLE__)
+#define OSAL_BENCH_HOSTED (1)
+#include <time.h>
+#else
+#define OSAL_BENCH_HOSTED (0)
+#endif
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif
+
+#if defined(__ARM_ARCH_7M__) || defined(__ARM_ARCH_7EM__) || defined(__ARM_ARCH_8M_MAIN__)
+#define OSAL_BENCH_DEMCR        (*(volatile uint32_t *)0xE000EDFCU)
+#define OSAL_BENCH_DWT_CTRL     (*(volatile uint32_t *)0xE0001000U)
+#define OSAL_BENCH_DWT_CYCCNT   (*(volatile uint32_t *)0xE0001004U)
+
+static uint32_t bench_cyccnt_last;
+static uint32_t bench_cyccnt_high;
+#endif
+
+void osal_bench_clock_init(void)
+{
+#if defined(__ARM_ARCH_7M__) || defined(__ARM_ARCH_7EM__) || defined(__ARM_ARCH_8M_MAIN__)
+    OSAL_BENCH_DEMCR |= (1UL << 24);     // TRCENA
+    OSAL_BENCH_DWT_CYCCNT = 0;
+    OSAL_BENCH_DWT_CTRL |= 1UL;          // CYCCNTENA
+#endif
+}
+
+uint64_t osal_bench_ref_ns(void)
+{
+#if OSAL_BENCH_HOSTED
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ULL + (uint64_t)ts.tv_nsec;
+#else
+    return 0;
+#endif
+}
+
+uint64_t osal_bench_cycles(void)
+{
+#if defined(__x86_64__) || defined(__i386__)
+    return __rdtsc();
+#elif defined(__aarch64__)
+    uint64_t cnt;
+    __asm__ volatile("isb; mrs %0, cntvct_el0" : "=r"(cnt));
+    return cnt;
+#elif defined(__ARM_ARCH_7M__) || defined(__ARM_ARCH_7EM__) || defined(__ARM_ARCH_8M_MAIN__)
+    /* Extend the 32-bit counter, the runner samples it far more often than it wraps. */
+    uint32_t primask = osal_enter_critical();
+    uint32_t now = OSAL_BENCH_DWT_CYCCNT;
+    if (now < bench_cyccnt_last)
+    {
+        bench_cyccnt_high++;
+    }
+    bench_cyccnt_last = now;
+    uint64_t cycles = ((uint64_t)bench_cyccnt_high << 32) | now;
+    osal_exit_critical(primask);
+    return cycles;
+#else
+    return osal_bench_ref_ns();
+#endif
+}
@@ -0,0 +1,12 @@
+#include "osal_bench.h"
+
+/* Standalone entry for host runs, target applications call osal_bench_start() themselves. */
+int main(void)
+{
+    if (osal_bench_start() != OSAL_SUCCESS)
+    {
+        return 1;
+    }
+    osal_task_start();
+    return 0;
+}
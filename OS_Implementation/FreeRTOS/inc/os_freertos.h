@@ -7,9 +7,24 @@
 #include "queue.h"
 #include "semphr.h"
 #include "timers.h"
+#include "osal_internal_time.h"
+
+/* Kernels before 11.0 call it configNUM_CORES on the SMP branch. */
+#if !defined(configNUMBER_OF_CORES) && defined(configNUM_CORES)
+#define configNUMBER_OF_CORES configNUM_CORES
+#endif
+
+#if (configNUMBER_OF_CORES > 1) && (configUSE_CORE_AFFINITY == 1)
+#define OS_FREERTOS_AFFINITY (1)
+#else
+#define OS_FREERTOS_AFFINITY (0)
+#endif
+
+/* Queues and semaphores that can be attached to an osal wait set at the same time. */
+#define OSAL_WAIT_SET_MAX_MEMBERS   16
 
 #define OS_MS_TO_TICKS(osal_time_in_ms) \
-    ((osal_time_in_ms == OSAL_MAX_DELAY)? (portMAX_DELAY): ((osal_tick_type_t)(((osal_tick_type_t)(osal_time_in_ms) * (osal_tick_type_t)configTICK_RATE_HZ) / (osal_tick_type_t)1000U)))
+    (((osal_time_in_ms) == OSAL_MAX_DELAY)? (portMAX_DELAY): ((TickType_t)osal_time_ms_to_ticks_at((osal_time_in_ms), configTICK_RATE_HZ)))
 
 
 #endif // __OS_FREERTOS_H__
@@ -0,0 +1,120 @@
+#include "osal_internal_event.h"
+#include "os_freertos.h"
+#include "event_groups.h"
+//#include "app_log.h"
+
+#if (OSAL_RTOS_SUPPORT == FREERTOS_SUPPORT)
+
+int32_t os_event_create_impl(osal_event_handle_t *p_event_handle)
+{
+    int32_t ret;
+    EventGroupHandle_t cur_event_handle;
+    cur_event_handle = xEventGroupCreate();
+    if (cur_event_handle == NULL)
+    {
+        ret = OSAL_ERROR;
+    }
+    else
+    {
+        *p_event_handle = (osal_event_handle_t)cur_event_handle;
+        ret = OSAL_SUCCESS;
+    }
+    return ret;
+}
+
+int32_t os_event_delete_impl(osal_event_handle_t event_handle)
+{
+    vEventGroupDelete((EventGroupHandle_t)event_handle);
+    return OSAL_SUCCESS;
+}
+
+int32_t os_event_set_impl(osal_event_handle_t event_handle, osal_event_bits_t bits)
+{
+    int32_t ret = OSAL_SUCCESS;
+    EventGroupHandle_t handle = (EventGroupHandle_t)event_handle;
+
+    if (OSAL_IS_IN_ISR())
+    {
+        /* Deferred to the timer daemon, needs INCLUDE_xTimerPendFunctionCall. */
+        BaseType_t xHigherPriorityTaskWoken = pdFALSE;
+        if (xEventGroupSetBitsFromISR(handle, (EventBits_t)bits, &xHigherPriorityTaskWoken) != pdPASS)
+        {
+            ret = OSAL_ERROR;
+        }
+        portYIELD_FROM_ISR(xHigherPriorityTaskWoken);
+    }
+    else
+    {
+        (void)xEventGroupSetBits(handle, (EventBits_t)bits);
+    }
+    return ret;
+}
+
+int32_t os_event_clear_impl(osal_event_handle_t event_handle, osal_event_bits_t bits)
+{
+    int32_t ret = OSAL_SUCCESS;
+    EventGroupHandle_t handle = (EventGroupHandle_t)event_handle;
+
+    if (OSAL_IS_IN_ISR())
+    {
+        if (xEventGroupClearBitsFromISR(handle, (EventBits_t)bits) != pdPASS)
+        {
+            ret = OSAL_ERROR;
+        }
+    }
+    else
+    {
+        (void)xEventGroupClearBits(handle, (EventBits_t)bits);
+    }
+    return ret;
+}
+
+int32_t os_event_wait_impl(osal_event_handle_t event_handle, osal_event_bits_t bits, uint32_t options,
+                           osal_event_bits_t *p_bits, osal_tick_type_t timeout)
+{
+    int32_t ret;
+    EventBits_t value;
+    bool satisfied;
+
+    if (OSAL_IS_IN_ISR())
+    {
+        return OSAL_ERR_IN_ISR;
+    }
+
+    value = xEventGroupWaitBits((EventGroupHandle_t)event_handle, (EventBits_t)bits,
+                                ((options & OSAL_EVENT_CLEAR_ON_EXIT) != 0U) ? pdTRUE : pdFALSE,
+                                ((options & OSAL_EVENT_WAIT_ALL) != 0U) ? pdTRUE : pdFALSE,
+                                OS_MS_TO_TICKS(timeout));
+
+    if ((options & OSAL_EVENT_WAIT_ALL) != 0U)
+    {
+        satisfied = ((value & bits) == bits);
+    }
+    else
+    {
+        satisfied = ((value & bits) != 0U);
+    }
+
+    if (p_bits != NULL)
+    {
+        *p_bits = (osal_event_bits_t)value;
+    }
+    ret = satisfied ? OSAL_SUCCESS : OSAL_ERROR_TIMEOUT;
+    return ret;
+}
+
+osal_event_bits_t os_event_get_impl(osal_event_handle_t event_handle)
+{
+    EventBits_t value;
+    if (OSAL_IS_IN_ISR())
+    {
+        value = xEventGroupGetBitsFromISR((EventGroupHandle_t)event_handle);
+    }
+    else
+    {
+        value = xEventGroupGetBits((EventGroupHandle_t)event_handle);
+    }
+    return (osal_event_bits_t)value;
+}
+
+#endif // OSAL_RTOS_SUPPORT
@@ -1,17 +1,106 @@
+#define OSAL_HEAP_IMPL_SOURCE
 #include "osal_internal_heap.h"
+#include "osal_internal_tlsf.h"
 #include "os_freertos.h"
 
 #if (OSAL_RTOS_SUPPORT == FREERTOS_SUPPORT)
 
+#if (OSAL_HEAP_USE_TLSF == 1)
+
+void os_heap_init_impl(void)
+{
+    osal_tlsf_heap_init();
+}
+
+void *os_heap_malloc_impl(size_t wanted_size)
+{
+    return osal_tlsf_heap_malloc(wanted_size);
+}
+
+void *os_heap_malloc_aligned_impl(size_t wanted_size, size_t align)
+{
+    return osal_tlsf_heap_memalign(wanted_size, align);
+}
+
+void os_heap_free_impl(void *ptr)
+{
+    osal_tlsf_heap_free(ptr);
+}
+
+void os_heap_get_stats_impl(osal_heap_stats_t *p_stats)
+{
+    osal_tlsf_heap_get_stats(p_stats);
+}
+
+size_t os_heap_get_free_impl(void)
+{
+    return osal_tlsf_heap_get_free();
+}
+
+#else
+
+static uint32_t os_heap_failed_count = 0;
+
+/* heap_4/heap_5 set themselves up inside the first pvPortMalloc() with the scheduler suspended. */
+void os_heap_init_impl(void)
+{
+}
+
 void *os_heap_malloc_impl(size_t wanted_size)
 {
     void *ptr = pvPortMalloc(wanted_size);
+    if (ptr == NULL)
+    {
+        os_heap_failed_count++;
+#if !((configUSE_MALLOC_FAILED_HOOK > 0) && USE_OSAL)
+        /* Otherwise vApplicationMallocFailedHook() reports it, for the kernel's own allocations too. */
+        osal_heap_report_failure(wanted_size);
+#endif
+    }
     return ptr;
 }
 
+void *os_heap_malloc_aligned_impl(size_t wanted_size, size_t align)
+{
+    void *raw;
+    if (align <= portBYTE_ALIGNMENT)
+    {
+        return os_heap_malloc_impl(wanted_size);
+    }
+    raw = os_heap_malloc_impl(wanted_size + OSAL_HEAP_ALIGN_OVERHEAD(align));
+    return (raw != NULL) ? osal_heap_align_block(raw, align) : NULL;
+}
+
 void os_heap_free_impl(void *ptr)
 {
-    vPortFree(ptr);
+    void *raw;
+    if (ptr != NULL)
+    {
+        raw = osal_heap_align_raw(ptr);
+        vPortFree((raw != NULL) ? raw : ptr);
+    }
+}
+
+/* vPortGetHeapStats() is provided by heap_4.c and heap_5.c. */
+void os_heap_get_stats_impl(osal_heap_stats_t *p_stats)
+{
+    HeapStats_t heap_stats;
+    vPortGetHeapStats(&heap_stats);
+    p_stats->total_size = configTOTAL_HEAP_SIZE;
+    p_stats->free_size = heap_stats.xAvailableHeapSpaceInBytes;
+    p_stats->min_ever_free_size = heap_stats.xMinimumEverFreeBytesRemaining;
+    p_stats->largest_free_block = heap_stats.xSizeOfLargestFreeBlockInBytes;
+    p_stats->free_blocks = (uint32_t)heap_stats.xNumberOfFreeBlocks;
+    p_stats->alloc_count = (uint32_t)heap_stats.xNumberOfSuccessfulAllocations;
+    p_stats->free_count = (uint32_t)heap_stats.xNumberOfSuccessfulFrees;
+    p_stats->failed_count = os_heap_failed_count;
 }
 
+size_t os_heap_get_free_impl(void)
+{
+    return xPortGetFreeHeapSize();
+}
+
+#endif // OSAL_HEAP_USE_TLSF
+
 #endif // OSAL_RTOS_SUPPORT
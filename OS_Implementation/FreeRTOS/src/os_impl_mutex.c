@@ -20,6 +20,31 @@ int32_t os_mutex_create_impl(osal_mutex_handle_t *p_mutex_handle)
     return ret;
 }
 
+#if (configSUPPORT_STATIC_ALLOCATION == 1)
+OSAL_STATIC_ASSERT(sizeof(osal_mutex_static_t) >= sizeof(StaticSemaphore_t), mutex_static_size);
+#endif
+
+int32_t os_mutex_create_static_impl(osal_mutex_handle_t *p_mutex_handle, void *cb_memory)
+{
+    int32_t ret;
+#if (configSUPPORT_STATIC_ALLOCATION == 1)
+    xSemaphoreHandle cur_mutex_handle;
+    cur_mutex_handle = xSemaphoreCreateMutexStatic((StaticSemaphore_t *)cb_memory);
+    if (cur_mutex_handle == NULL)
+    {
+        ret = OSAL_ERROR;
+    }
+    else
+    {
+        *p_mutex_handle = (osal_mutex_handle_t)cur_mutex_handle;
+        ret = OSAL_SUCCESS;
+    }
+#else
+    ret = OSAL_ERR_NOT_IMPLEMENTED;
+#endif
+    return ret;
+}
+
 void os_mutex_delete_impl(osal_mutex_handle_t mutex_handle)
 {
     vSemaphoreDelete((xSemaphoreHandle)mutex_handle);
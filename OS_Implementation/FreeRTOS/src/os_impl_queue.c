@@ -22,6 +22,31 @@ int32_t os_queue_create_impl( size_t queue_depth, size_t data_size,osal_queue_ha
     return ret;
 }
 
+#if (configSUPPORT_STATIC_ALLOCATION == 1)
+OSAL_STATIC_ASSERT(sizeof(osal_queue_static_t) >= sizeof(StaticQueue_t), queue_static_size);
+#endif
+
+int32_t os_queue_create_static_impl(size_t queue_depth, size_t data_size, void *storage, void *cb_memory, osal_queue_handle_t *p_queue_handle)
+{
+    int32_t ret;
+#if (configSUPPORT_STATIC_ALLOCATION == 1)
+    xQueueHandle cur_queue_handle;
+    cur_queue_handle = xQueueCreateStatic(queue_depth, data_size, (uint8_t *)storage, (StaticQueue_t *)cb_memory);
+    if (cur_queue_handle == NULL)
+    {
+        ret = OSAL_ERROR;
+    }
+    else
+    {
+        *p_queue_handle = (osal_queue_handle_t)cur_queue_handle;
+        ret = OSAL_SUCCESS;
+    }
+#else
+    ret = OSAL_ERR_NOT_IMPLEMENTED;
+#endif
+    return ret;
+}
+
 void os_queue_delete_impl(osal_queue_handle_t queue_handle)
 {
     vQueueDelete((xQueueHandle)queue_handle);
@@ -112,4 +137,104 @@ int32_t os_queue_msg_waiting_impl(osal_queue_handle_t queue_handle)
     return ret;
 }
 
+/* Moves messages without blocking while the scheduler is suspended, wakeups are deferred to xTaskResumeAll(). */
+static size_t os_queue_send_batch(xQueueHandle handle, const uint8_t *data, size_t data_size, size_t count)
+{
+    size_t sent = 0;
+    while (sent < count && xQueueSend(handle, &data[sent * data_size], 0) == pdPASS)
+    {
+        sent++;
+    }
+    return sent;
+}
+
+static size_t os_queue_receive_batch(xQueueHandle handle, uint8_t *data, size_t data_size, size_t count)
+{
+    size_t received = 0;
+    while (received < count && xQueueReceive(handle, &data[received * data_size], 0) == pdPASS)
+    {
+        received++;
+    }
+    return received;
+}
+
+size_t os_queue_send_many_impl(osal_queue_handle_t queue_handle, const void *data, size_t data_size, size_t count, osal_tick_type_t timeout)
+{
+    size_t sent = 0;
+    const uint8_t *p_data = (const uint8_t *)data;
+    xQueueHandle handle = (xQueueHandle)queue_handle;
+
+    if (handle == NULL || data == NULL || count == 0U)
+    {
+        return 0;
+    }
+
+    if (OSAL_IS_IN_ISR())
+    {
+        BaseType_t xHigherPriorityTaskWoken = pdFALSE;
+        while (sent < count && xQueueSendFromISR(handle, &p_data[sent * data_size], &xHigherPriorityTaskWoken) == pdPASS)
+        {
+            sent++;
+        }
+        if (pdFALSE != xHigherPriorityTaskWoken)
+        {
+            portYIELD_FROM_ISR(xHigherPriorityTaskWoken);
+        }
+    }
+    else
+    {
+        vTaskSuspendAll();
+        sent = os_queue_send_batch(handle, p_data, data_size, count);
+        (void)xTaskResumeAll();
+
+        /* Queue was full: block for the first slot only, then move the rest in one section. */
+        if (sent == 0U && timeout != 0U && xQueueSend(handle, p_data, OS_MS_TO_TICKS(timeout)) == pdPASS)
+        {
+            vTaskSuspendAll();
+            sent = 1U + os_queue_send_batch(handle, &p_data[data_size], data_size, count - 1U);
+            (void)xTaskResumeAll();
+        }
+    }
+    return sent;
+}
+
+size_t os_queue_receive_many_impl(osal_queue_handle_t queue_handle, void *data, size_t data_size, size_t count, osal_tick_type_t timeout)
+{
+    size_t received = 0;
+    uint8_t *p_data = (uint8_t *)data;
+    xQueueHandle handle = (xQueueHandle)queue_handle;
+
+    if (handle == NULL || data == NULL || count == 0U)
+    {
+        return 0;
+    }
+
+    if (OSAL_IS_IN_ISR())
+    {
+        BaseType_t xHigherPriorityTaskWoken = pdFALSE;
+        while (received < count && xQueueReceiveFromISR(handle, &p_data[received * data_size], &xHigherPriorityTaskWoken) == pdPASS)
+        {
+            received++;
+        }
+        if (pdFALSE != xHigherPriorityTaskWoken)
+        {
+            portYIELD_FROM_ISR(xHigherPriorityTaskWoken);
+        }
+    }
+    else
+    {
+        vTaskSuspendAll();
+        received = os_queue_receive_batch(handle, p_data, data_size, count);
+        (void)xTaskResumeAll();
+
+        if (received == 0U && timeout != 0U && xQueueReceive(handle, p_data, OS_MS_TO_TICKS(timeout)) == pdPASS)
+        {
+            vTaskSuspendAll();
+            received = 1U + os_queue_receive_batch(handle, &p_data[data_size], data_size, count - 1U);
+            (void)xTaskResumeAll();
+        }
+    }
+    return received;
+}
+
 #endif // OSAL_RTOS_SUPPORT
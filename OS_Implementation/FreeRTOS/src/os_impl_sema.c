@@ -40,6 +40,52 @@ int32_t os_sema_countings_create_impl(osal_sema_handle_t *p_sema_handle, uint32_
     return ret;
 }
 
+#if (configSUPPORT_STATIC_ALLOCATION == 1)
+OSAL_STATIC_ASSERT(sizeof(osal_sema_static_t) >= sizeof(StaticSemaphore_t), sema_static_size);
+#endif
+
+int32_t os_sema_binary_create_static_impl(osal_sema_handle_t *p_sema_handle, void *cb_memory)
+{
+    int32_t ret;
+#if (configSUPPORT_STATIC_ALLOCATION == 1)
+    xSemaphoreHandle cur_sema_handle;
+    cur_sema_handle = xSemaphoreCreateBinaryStatic((StaticSemaphore_t *)cb_memory);
+    if (cur_sema_handle == NULL)
+    {
+        ret = OSAL_ERROR;
+    }
+    else
+    {
+        *p_sema_handle = cur_sema_handle;
+        ret = OSAL_SUCCESS;
+    }
+#else
+    ret = OSAL_ERR_NOT_IMPLEMENTED;
+#endif
+    return ret;
+}
+
+int32_t os_sema_countings_create_static_impl(osal_sema_handle_t *p_sema_handle, uint32_t max_count, uint32_t init_count, void *cb_memory)
+{
+    int32_t ret;
+#if (configSUPPORT_STATIC_ALLOCATION == 1)
+    xSemaphoreHandle cur_sema_handle;
+    cur_sema_handle = xSemaphoreCreateCountingStatic(max_count, init_count, (StaticSemaphore_t *)cb_memory);
+    if (cur_sema_handle == NULL)
+    {
+        ret = OSAL_ERROR;
+    }
+    else
+    {
+        *p_sema_handle = cur_sema_handle;
+        ret = OSAL_SUCCESS;
+    }
+#else
+    ret = OSAL_ERR_NOT_IMPLEMENTED;
+#endif
+    return ret;
+}
+
 void os_sema_delete_impl(osal_sema_handle_t sema_handle)
 {
     vSemaphoreDelete((xSemaphoreHandle)sema_handle);
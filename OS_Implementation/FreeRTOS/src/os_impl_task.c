@@ -1,4 +1,5 @@
 #include "osal_internal_task.h"
+#include "osal_internal_heap.h"
 #include "os_freertos.h"
 //#include "app_log.h"
 
@@ -6,14 +7,82 @@
 
 #define OSAL_CHECK_APINAME(str) OSAL_CHECK_STRING(str, configMAX_TASK_NAME_LEN, OSAL_ERR_NAME_TOO_LONG)
 
+#if (configSUPPORT_STATIC_ALLOCATION == 1)
+OSAL_STATIC_ASSERT(sizeof(osal_task_static_t) >= sizeof(StaticTask_t), task_static_size);
+#endif
+
+/* The OSAL takes the top thread local storage slots, the lower ones stay with the application. */
+#if (configNUM_THREAD_LOCAL_STORAGE_POINTERS >= OSAL_TASK_TLS_COUNT)
+#define OS_TASK_TLS_BASE    (configNUM_THREAD_LOCAL_STORAGE_POINTERS - OSAL_TASK_TLS_COUNT)
+#endif
+
+/* A task deleted on another core may run on until that core reschedules, its cache must outlive it. */
+#if (OSAL_HEAP_CACHE_ENABLE == 1) && (configNUMBER_OF_CORES > 1) && (configTHREAD_LOCAL_STORAGE_DELETE_CALLBACKS != 1)
+#error "OSAL_HEAP_CACHE_ENABLE on SMP needs configTHREAD_LOCAL_STORAGE_DELETE_CALLBACKS == 1"
+#endif
+
+#if (OSAL_HEAP_CACHE_ENABLE == 1) && (configTHREAD_LOCAL_STORAGE_DELETE_CALLBACKS == 1)
+/* Called by the kernel when it frees the TCB, the task is gone by then. */
+static void os_task_tls_delete(int index, void *value)
+{
+    if (index == (int)(OS_TASK_TLS_BASE + OSAL_TASK_TLS_HEAP_CACHE))
+    {
+        osal_heap_cache_release(value);
+    }
+}
+#endif
+
+#if (OS_FREERTOS_AFFINITY == 1)
+static UBaseType_t os_task_affinity(osal_core_mask_t core_mask)
+{
+    return (core_mask == OSAL_CORE_MASK_ANY) ? (UBaseType_t)tskNO_AFFINITY : (UBaseType_t)core_mask;
+}
+#endif
+
 int32_t os_task_create_impl(osal_task_internal_record_t *p_task)
 {
     int32_t ret = OSAL_SUCCESS;
     OSAL_CHECK_APINAME(p_task->task_name);
 
+    if (p_task->cb_memory != NULL)
+    {
+#if (configSUPPORT_STATIC_ALLOCATION == 1)
+        /* Static stacks are sized in bytes, FreeRTOS counts StackType_t words. */
+#if (OS_FREERTOS_AFFINITY == 1)
+        TaskHandle_t cur_task_handle = xTaskCreateStaticAffinitySet(p_task->entry_function_pointer, p_task->task_name,
+                                                                    p_task->stack_size / sizeof(StackType_t), p_task->entry_arg,
+                                                                    p_task->priority, (StackType_t *)p_task->stack_pointer,
+                                                                    (StaticTask_t *)p_task->cb_memory,
+                                                                    os_task_affinity(p_task->core_mask));
+#else
+        TaskHandle_t cur_task_handle = xTaskCreateStatic(p_task->entry_function_pointer, p_task->task_name,
+                                                         p_task->stack_size / sizeof(StackType_t), p_task->entry_arg,
+                                                         p_task->priority, (StackType_t *)p_task->stack_pointer,
+                                                         (StaticTask_t *)p_task->cb_memory);
+#endif
+        if (cur_task_handle == NULL)
+        {
+            ret = OSAL_ERROR;
+        }
+        else if (p_task->p_task_handle)
+        {
+            *(p_task->p_task_handle) = (osal_task_handle_t)cur_task_handle;
+        }
+#else
+        ret = OSAL_ERR_NOT_IMPLEMENTED;
+#endif
+        return ret;
+    }
+
     BaseType_t error_code;
+#if (OS_FREERTOS_AFFINITY == 1)
+    error_code = xTaskCreateAffinitySet(p_task->entry_function_pointer, p_task->task_name, p_task->stack_size,
+                                        p_task->entry_arg, p_task->priority, os_task_affinity(p_task->core_mask),
+                                        p_task->p_task_handle);
+#else
     error_code = xTaskCreate(p_task->entry_function_pointer, p_task->task_name, p_task->stack_size,
                              p_task->entry_arg, p_task->priority, p_task->p_task_handle);
+#endif
     if (pdPASS != error_code)
     {
         ret = OSAL_ERROR;
@@ -24,7 +93,18 @@ int32_t os_task_create_impl(osal_task_internal_record_t *p_task)
 #if (INCLUDE_vTaskDelete == 1)
 void os_task_delete_impl(osal_task_handle_t task_handle)
 {
+#if (OSAL_HEAP_CACHE_ENABLE == 1) && (configTHREAD_LOCAL_STORAGE_DELETE_CALLBACKS != 1)
+    /* One core: another task never runs again once vTaskDelete() returns. The caller's own cache is already flushed. */
+    void *cache = NULL;
+    if (task_handle != NULL && (TaskHandle_t)task_handle != xTaskGetCurrentTaskHandle())
+    {
+        cache = pvTaskGetThreadLocalStoragePointer((TaskHandle_t)task_handle, (BaseType_t)(OS_TASK_TLS_BASE + OSAL_TASK_TLS_HEAP_CACHE));
+    }
+    vTaskDelete(task_handle);
+    osal_heap_cache_release(cache);
+#else
     vTaskDelete(task_handle);
+#endif
 }
 #endif
 
@@ -33,17 +113,60 @@ void os_task_start_impl(void)
     vTaskStartScheduler();
 }
 
+int32_t os_task_set_affinity_impl(osal_task_handle_t task_handle, osal_core_mask_t core_mask)
+{
+#if (OS_FREERTOS_AFFINITY == 1)
+    vTaskCoreAffinitySet((TaskHandle_t)task_handle, (UBaseType_t)core_mask);
+#else
+    (void)task_handle;
+    (void)core_mask;    // one core, or SMP without configUSE_CORE_AFFINITY: every task may run anywhere
+#endif
+    return OSAL_SUCCESS;
+}
+
+uint32_t os_task_get_core_impl(void)
+{
+#if (configNUMBER_OF_CORES > 1)
+    return (uint32_t)portGET_CORE_ID();
+#else
+    return 0U;
+#endif
+}
+
+uint32_t os_task_core_count_impl(void)
+{
+#if (configNUMBER_OF_CORES > 1)
+    return (uint32_t)configNUMBER_OF_CORES;
+#else
+    return 1U;
+#endif
+}
+
 #if (INCLUDE_vTaskSuspend == 1)
 void os_task_suspend_impl(osal_task_handle_t task_handle)
 {
     vTaskSuspend(task_handle);
 }
+#endif // INCLUDE_vTaskSuspend
 
-void os_task_suspend_all_impl(void)
+/* The kernel counts the nesting itself, uxSchedulerSuspended. */
+int32_t os_sched_lock_impl(void)
 {
     vTaskSuspendAll();
+    return OSAL_SUCCESS;
+}
+
+int32_t os_sched_unlock_impl(void)
+{
+#if (INCLUDE_xTaskGetSchedulerState == 1)
+    if (xTaskGetSchedulerState() != taskSCHEDULER_SUSPENDED)
+    {
+        return OSAL_ERR_INCORRECT_OBJ_STATE;
+    }
+#endif
+    (void)xTaskResumeAll();
+    return OSAL_SUCCESS;
 }
-#endif // INCLUDE_vTaskSuspend
 
 void os_task_resume_impl(osal_task_handle_t task_handle)
 {
@@ -69,6 +192,16 @@ void os_task_delay_ms_impl(uint32_t ms)
 }
 #endif
 
+#if (INCLUDE_xTaskDelayUntil == 1)
+int32_t os_task_delay_until_impl(osal_tick_type_t *p_last_wake, osal_tick_type_t period)
+{
+    TickType_t last_wake = (TickType_t)*p_last_wake;
+    BaseType_t delayed = xTaskDelayUntil(&last_wake, (TickType_t)period);
+    *p_last_wake = (osal_tick_type_t)last_wake;
+    return (delayed != pdFALSE) ? OSAL_SUCCESS : OSAL_ERR_DEADLINE_MISSED;
+}
+#endif
+
 uint32_t os_enter_critical_impl(void)
 {
     if (OSAL_IS_IN_ISR())
@@ -130,6 +263,7 @@ void vApplicationStackOverflowHook(TaskHandle_t xTask, char *pcTaskName)
 void vApplicationMallocFailedHook()
 {
     APP_LOG_DEBUG(">>>> FReeRTOS Malloc FAILED !!!");
+    osal_heap_report_failure(0U);
 }
 #endif // configUSE_MALLOC_FAILED_HOOK
 
@@ -139,4 +273,242 @@ osal_tick_type_t os_task_get_tick_count_impl(void)
     return os_ticks;
 }
 
+osal_task_handle_t os_task_get_current_impl(void)
+{
+    if (OSAL_IS_IN_ISR())
+    {
+        return NULL;
+    }
+    return (osal_task_handle_t)xTaskGetCurrentTaskHandle();
+}
+
+osal_priority_t os_task_get_priority_impl(osal_task_handle_t task_handle)
+{
+    return (osal_priority_t)uxTaskPriorityGet((TaskHandle_t)task_handle);
+}
+
+#if (configNUM_THREAD_LOCAL_STORAGE_POINTERS >= OSAL_TASK_TLS_COUNT)
+int32_t os_task_tls_set_impl(uint32_t index, void *value)
+{
+    if (OSAL_IS_IN_ISR() || index >= OSAL_TASK_TLS_COUNT)
+    {
+        return OSAL_ERR_INCORRECT_OBJ_STATE;
+    }
+#if (OSAL_HEAP_CACHE_ENABLE == 1) && (configTHREAD_LOCAL_STORAGE_DELETE_CALLBACKS == 1)
+    vTaskSetThreadLocalStoragePointerAndDelCallback(NULL, (BaseType_t)(OS_TASK_TLS_BASE + index), value, os_task_tls_delete);
+#else
+    vTaskSetThreadLocalStoragePointer(NULL, (BaseType_t)(OS_TASK_TLS_BASE + index), value);
+#endif
+    return OSAL_SUCCESS;
+}
+
+void *os_task_tls_get_impl(uint32_t index)
+{
+    if (OSAL_IS_IN_ISR() || index >= OSAL_TASK_TLS_COUNT)
+    {
+        return NULL;
+    }
+    return pvTaskGetThreadLocalStoragePointer(NULL, (BaseType_t)(OS_TASK_TLS_BASE + index));
+}
+
+#if (OSAL_TASK_SWITCH_COUNT_ENABLE == 1)
+/* Called from traceTASK_SWITCHED_IN(), pxCurrentTCB is already the incoming task. */
+void osal_task_switched_in(void)
+{
+    uintptr_t count = (uintptr_t)pvTaskGetThreadLocalStoragePointer(NULL, (BaseType_t)(OS_TASK_TLS_BASE + OSAL_TASK_TLS_SWITCHES));
+    vTaskSetThreadLocalStoragePointer(NULL, (BaseType_t)(OS_TASK_TLS_BASE + OSAL_TASK_TLS_SWITCHES), (void *)(count + 1U));
+}
+#endif
+#else
+#if (OSAL_HEAP_CACHE_ENABLE == 1) || (OSAL_TASK_SWITCH_COUNT_ENABLE == 1)
+#error "OSAL_HEAP_CACHE_ENABLE and OSAL_TASK_SWITCH_COUNT_ENABLE need configNUM_THREAD_LOCAL_STORAGE_POINTERS >= OSAL_TASK_TLS_COUNT"
+#endif
+
+int32_t os_task_tls_set_impl(uint32_t index, void *value)
+{
+    (void)index;
+    (void)value;
+    return OSAL_ERR_NOT_IMPLEMENTED;
+}
+
+void *os_task_tls_get_impl(uint32_t index)
+{
+    (void)index;
+    return NULL;
+}
+#endif // configNUM_THREAD_LOCAL_STORAGE_POINTERS
+
+#if (configUSE_TRACE_FACILITY == 1)
+#ifndef configRUN_TIME_COUNTER_TYPE
+#define configRUN_TIME_COUNTER_TYPE uint32_t   // kernels before 10.5
+#endif
+
+static void os_task_stats_fill(const TaskStatus_t *p_status, osal_task_stats_t *p_stats)
+{
+    p_stats->handle = (osal_task_handle_t)p_status->xHandle;
+    strncpy(p_stats->name, p_status->pcTaskName, sizeof(p_stats->name) - 1U);
+    switch (p_status->eCurrentState)
+    {
+        case eRunning:
+            p_stats->state = OSAL_TASK_STATE_RUNNING;
+            break;
+        case eReady:
+            p_stats->state = OSAL_TASK_STATE_READY;
+            break;
+        case eBlocked:
+            p_stats->state = OSAL_TASK_STATE_BLOCKED;
+            break;
+        case eSuspended:
+            p_stats->state = OSAL_TASK_STATE_SUSPENDED;
+            break;
+        default:
+            p_stats->state = OSAL_TASK_STATE_DELETED;
+            break;
+    }
+    p_stats->priority = (osal_priority_t)p_status->uxCurrentPriority;
+    /* The TCB does not keep the stack size, only how much of it was never touched. */
+    p_stats->stack_free_min = (size_t)p_status->usStackHighWaterMark * sizeof(StackType_t);
+#if (configGENERATE_RUN_TIME_STATS == 1)
+    p_stats->run_time = (uint64_t)p_status->ulRunTimeCounter;
+#endif
+#if (OSAL_TASK_SWITCH_COUNT_ENABLE == 1)
+    p_stats->switch_count = (uint32_t)(uintptr_t)pvTaskGetThreadLocalStoragePointer(p_status->xHandle,
+                                                                                    (BaseType_t)(OS_TASK_TLS_BASE + OSAL_TASK_TLS_SWITCHES));
+#endif
+}
+
+int32_t os_task_get_stats_impl(osal_task_handle_t task_handle, osal_task_stats_t *p_stats)
+{
+    TaskStatus_t status;
+
+    /* eInvalid has the kernel look the state up, pdTRUE scans the stack for the high-water mark. */
+    vTaskGetInfo((TaskHandle_t)task_handle, &status, pdTRUE, eInvalid);
+    os_task_stats_fill(&status, p_stats);
+    return OSAL_SUCCESS;
+}
+
+size_t os_task_list_stats_impl(osal_task_stats_t *p_stats, size_t max_count, uint64_t *p_total_run_time)
+{
+    configRUN_TIME_COUNTER_TYPE total = 0;
+    /* Room for a few tasks created between counting and taking the snapshot. */
+    UBaseType_t capacity = uxTaskGetNumberOfTasks() + 4U;
+    TaskStatus_t *p_status = (TaskStatus_t *)os_heap_malloc_impl(capacity * sizeof(TaskStatus_t));
+    if (p_status == NULL)
+    {
+        return 0U;
+    }
+
+    UBaseType_t count = uxTaskGetSystemState(p_status, capacity, &total);
+    size_t written = 0U;
+    for (UBaseType_t i = 0; i < count && written < max_count; i++)
+    {
+        os_task_stats_fill(&p_status[i], &p_stats[written]);
+        written++;
+    }
+    os_heap_free_impl(p_status);
+
+    if (p_total_run_time != NULL)
+    {
+        *p_total_run_time = (uint64_t)total;
+    }
+    return written;
+}
+#else
+int32_t os_task_get_stats_impl(osal_task_handle_t task_handle, osal_task_stats_t *p_stats)
+{
+    (void)task_handle;
+    (void)p_stats;
+    return OSAL_ERR_NOT_IMPLEMENTED;
+}
+
+size_t os_task_list_stats_impl(osal_task_stats_t *p_stats, size_t max_count, uint64_t *p_total_run_time)
+{
+    (void)p_stats;
+    (void)max_count;
+    (void)p_total_run_time;
+    return 0U;
+}
+#endif // configUSE_TRACE_FACILITY
+
+int32_t os_task_notify_give_impl(osal_task_handle_t task_handle)
+{
+    if (OSAL_IS_IN_ISR())
+    {
+        BaseType_t xHigherPriorityTaskWoken = pdFALSE;
+        vTaskNotifyGiveFromISR((TaskHandle_t)task_handle, &xHigherPriorityTaskWoken);
+        portYIELD_FROM_ISR(xHigherPriorityTaskWoken);
+    }
+    else
+    {
+        (void)xTaskNotifyGive((TaskHandle_t)task_handle);
+    }
+    return OSAL_SUCCESS;
+}
+
+int32_t os_task_notify_take_impl(bool clear_on_exit, uint32_t *p_count, osal_tick_type_t timeout)
+{
+    int32_t ret;
+    uint32_t count;
+
+    if (OSAL_IS_IN_ISR())
+    {
+        return OSAL_ERR_IN_ISR;
+    }
+
+    count = ulTaskNotifyTake(clear_on_exit ? pdTRUE : pdFALSE, OS_MS_TO_TICKS(timeout));
+    if (count == 0U)
+    {
+        ret = OSAL_ERROR_TIMEOUT;
+    }
+    else
+    {
+        if (p_count != NULL)
+        {
+            *p_count = count;
+        }
+        ret = OSAL_SUCCESS;
+    }
+    return ret;
+}
+
+int32_t os_task_notify_set_bits_impl(osal_task_handle_t task_handle, uint32_t bits)
+{
+    if (OSAL_IS_IN_ISR())
+    {
+        BaseType_t xHigherPriorityTaskWoken = pdFALSE;
+        (void)xTaskNotifyFromISR((TaskHandle_t)task_handle, bits, eSetBits, &xHigherPriorityTaskWoken);
+        portYIELD_FROM_ISR(xHigherPriorityTaskWoken);
+    }
+    else
+    {
+        (void)xTaskNotify((TaskHandle_t)task_handle, bits, eSetBits);
+    }
+    return OSAL_SUCCESS;
+}
+
+int32_t os_task_notify_wait_impl(uint32_t clear_on_entry, uint32_t clear_on_exit, uint32_t *p_value, osal_tick_type_t timeout)
+{
+    int32_t ret;
+    uint32_t value = 0;
+
+    if (OSAL_IS_IN_ISR())
+    {
+        return OSAL_ERR_IN_ISR;
+    }
+
+    if (xTaskNotifyWait(clear_on_entry, clear_on_exit, &value, OS_MS_TO_TICKS(timeout)) == pdTRUE)
+    {
+        if (p_value != NULL)
+        {
+            *p_value = value;
+        }
+        ret = OSAL_SUCCESS;
+    }
+    else
+    {
+        ret = OSAL_ERROR_TIMEOUT;
+    }
+    return ret;
+}
+
 #endif // OSAL_RTOS_SUPPORT
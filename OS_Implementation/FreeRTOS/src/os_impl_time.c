@@ -0,0 +1,36 @@
+#include "osal_internal_time.h"
+#include "os_freertos.h"
+//#include "app_log.h"
+
+#if (OSAL_RTOS_SUPPORT == FREERTOS_SUPPORT)
+
+osal_time_us_t os_time_now_us_impl(void)
+{
+    TimeOut_t now;
+
+    /* The kernel counts tick wraps in xOverflowCount and reads both in one critical section. */
+    if (OSAL_IS_IN_ISR())
+    {
+        UBaseType_t saved = taskENTER_CRITICAL_FROM_ISR();
+        vTaskInternalSetTimeOutState(&now);
+        taskEXIT_CRITICAL_FROM_ISR(saved);
+    }
+    else
+    {
+        vTaskSetTimeOutState(&now);
+    }
+#if defined(configTICK_TYPE_WIDTH_IN_BITS) && defined(TICK_TYPE_WIDTH_64_BITS) && (configTICK_TYPE_WIDTH_IN_BITS == TICK_TYPE_WIDTH_64_BITS)
+    /* A 64-bit tick count does not wrap, and shifting the overflow count by 64 would be undefined. */
+    uint64_t ticks = (uint64_t)now.xTimeOnEntering;
+#else
+    uint64_t ticks = ((uint64_t)(UBaseType_t)now.xOverflowCount << (8U * sizeof(TickType_t))) | (uint64_t)now.xTimeOnEntering;
+#endif
+    return osal_time_ticks_to_us_at(ticks, configTICK_RATE_HZ);
+}
+
+uint32_t os_time_tick_rate_hz_impl(void)
+{
+    return configTICK_RATE_HZ;
+}
+
+#endif // OSAL_RTOS_SUPPORT
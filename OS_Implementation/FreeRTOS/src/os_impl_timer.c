@@ -11,10 +11,27 @@ static void os_timer_cb(TimerHandle_t xTimer)
     timer->func(timer->timer_handle, timer->arg);
 }
 
+#if (configSUPPORT_STATIC_ALLOCATION == 1)
+OSAL_STATIC_ASSERT(OSAL_TIMER_STATIC_CB_SIZE >= sizeof(StaticTimer_t), timer_static_size);
+#endif
+
 int32_t os_timer_create_impl(osal_timer_handle_t *p_timer_handle, osal_timer_internal_record_t *timer_record)
 {
     int32_t ret = OSAL_SUCCESS;
-    TimerHandle_t cur_timer_handle = xTimerCreate(timer_record->timer_name, timer_record->timer_period, timer_record->auto_reload, &timer_record->timer_id, os_timer_cb);
+    TimerHandle_t cur_timer_handle;
+    if (timer_record->cb_memory != NULL)
+    {
+#if (configSUPPORT_STATIC_ALLOCATION == 1)
+        cur_timer_handle = xTimerCreateStatic(timer_record->timer_name, OS_MS_TO_TICKS(timer_record->timer_period), timer_record->auto_reload, &timer_record->timer_id, os_timer_cb,
+                                              (StaticTimer_t *)timer_record->cb_memory);
+#else
+        return OSAL_ERR_NOT_IMPLEMENTED;
+#endif
+    }
+    else
+    {
+        cur_timer_handle = xTimerCreate(timer_record->timer_name, OS_MS_TO_TICKS(timer_record->timer_period), timer_record->auto_reload, &timer_record->timer_id, os_timer_cb);
+    }
     *p_timer_handle = (osal_timer_handle_t)cur_timer_handle;
     timer_record->timer_id.timer_handle = *p_timer_handle;
     if (NULL == *p_timer_handle)
@@ -82,7 +99,7 @@ int32_t os_timer_period_change_impl(osal_timer_handle_t timer_handle, osal_tick_
     if (OSAL_IS_IN_ISR())
     {
         BaseType_t xHigherPriorityTaskWoken = pdFALSE;
-        status = xTimerChangePeriodFromISR((TimerHandle_t)timer_handle, new_period, &xHigherPriorityTaskWoken);
+        status = xTimerChangePeriodFromISR((TimerHandle_t)timer_handle, OS_MS_TO_TICKS(new_period), &xHigherPriorityTaskWoken);
         if (pdFALSE != xHigherPriorityTaskWoken)
         {
             portYIELD_FROM_ISR(xHigherPriorityTaskWoken);
@@ -99,14 +116,37 @@ int32_t os_timer_period_change_impl(osal_timer_handle_t timer_handle, osal_tick_
     return ret;
 }
 
+#if (INCLUDE_xTimerPendFunctionCall != 1)
+#error "osal timers need INCLUDE_xTimerPendFunctionCall == 1, deleted timer records are freed from the timer daemon"
+#endif
+
+static void os_timer_record_free(void *timer_record, uint32_t unused)
+{
+    (void)unused;
+    os_heap_free_impl(timer_record);
+}
+
 int32_t os_timer_delete_impl(osal_timer_handle_t timer_handle, osal_tick_type_t ticks_to_wait)
 {
     int32_t ret = OSAL_SUCCESS;
+    osal_timer_internal_record_t *timer_record = (osal_timer_internal_record_t *)((uint8_t *)pvTimerGetTimerID((TimerHandle_t)timer_handle)
+                                                                                  - offsetof(osal_timer_internal_record_t, timer_id));
     BaseType_t status = xTimerDelete((TimerHandle_t)timer_handle, OS_MS_TO_TICKS(ticks_to_wait));
     if (pdFAIL == status)
     {
         ret = OSAL_ERROR;
     }
+    else if (timer_record->cb_memory == NULL)
+    {
+        /*
+         * The delete is only queued to the timer daemon, which may still run the callback
+         * with this record. Free it from the daemon, behind the delete command.
+         */
+        if (xTimerPendFunctionCall(os_timer_record_free, timer_record, 0, OS_MS_TO_TICKS(ticks_to_wait)) == pdFAIL)
+        {
+            ret = OSAL_ERROR;
+        }
+    }
     return ret;
 }
 
@@ -137,7 +177,7 @@ int32_t os_timer_reset_impl(osal_timer_handle_t timer_handle, osal_tick_type_t t
 
 osal_tick_type_t os_timer_period_get_impl(osal_timer_handle_t timer_handle)
 {
-    return xTimerGetPeriod((TimerHandle_t)timer_handle);
+    return osal_time_ticks_to_ms_at((osal_tick_type_t)xTimerGetPeriod((TimerHandle_t)timer_handle), configTICK_RATE_HZ);
 }
 
 #endif // OSAL_RTOS_SUPPORT
@@ -0,0 +1,214 @@
+#include "osal_internal_wait.h"
+#include "os_freertos.h"
+//#include "app_log.h"
+
+#if (OSAL_RTOS_SUPPORT == FREERTOS_SUPPORT)
+
+#if (configUSE_QUEUE_SETS == 1)
+
+/*
+ * The kernel keeps no list of a set's members and does not detach them on delete,
+ * the member table remembers them so os_wait_set_delete_impl() can.
+ */
+typedef struct
+{
+    QueueSetMemberHandle_t member;
+    QueueSetHandle_t set;
+} os_wait_member_t;
+
+static os_wait_member_t os_wait_members[OSAL_WAIT_SET_MAX_MEMBERS];
+
+int32_t os_wait_set_create_impl(size_t max_events, osal_wait_set_handle_t *p_set_handle)
+{
+    int32_t ret;
+    QueueSetHandle_t cur_set_handle;
+    cur_set_handle = xQueueCreateSet((UBaseType_t)max_events);
+    if (cur_set_handle == NULL)
+    {
+        ret = OSAL_ERROR;
+    }
+    else
+    {
+        *p_set_handle = (osal_wait_set_handle_t)cur_set_handle;
+        ret = OSAL_SUCCESS;
+    }
+    return ret;
+}
+
+int32_t os_wait_set_delete_impl(osal_wait_set_handle_t set_handle)
+{
+    int32_t ret = OSAL_SUCCESS;
+    QueueSetHandle_t set = (QueueSetHandle_t)set_handle;
+
+    taskENTER_CRITICAL();
+    /* xQueueRemoveFromSet() refuses members holding data, check all of them before detaching any. */
+    for (uint32_t i = 0; i < OSAL_WAIT_SET_MAX_MEMBERS; i++)
+    {
+        if (os_wait_members[i].set == set && uxQueueMessagesWaiting((QueueHandle_t)os_wait_members[i].member) != 0U)
+        {
+            ret = OSAL_ERR_OBJECT_IN_USE;
+            break;
+        }
+    }
+    if (ret == OSAL_SUCCESS)
+    {
+        for (uint32_t i = 0; i < OSAL_WAIT_SET_MAX_MEMBERS; i++)
+        {
+            if (os_wait_members[i].set == set)
+            {
+                (void)xQueueRemoveFromSet(os_wait_members[i].member, set);
+                os_wait_members[i].member = NULL;
+                os_wait_members[i].set = NULL;
+            }
+        }
+    }
+    taskEXIT_CRITICAL();
+
+    if (ret == OSAL_SUCCESS)
+    {
+        vQueueDelete((QueueHandle_t)set);
+    }
+    return ret;
+}
+
+static int32_t os_wait_set_add(osal_wait_set_handle_t set_handle, void *member_handle)
+{
+    int32_t ret;
+    os_wait_member_t *free_slot = NULL;
+
+    taskENTER_CRITICAL();
+    for (uint32_t i = 0; i < OSAL_WAIT_SET_MAX_MEMBERS; i++)
+    {
+        if (os_wait_members[i].member == NULL)
+        {
+            free_slot = &os_wait_members[i];
+            break;
+        }
+    }
+    /* Fails when the member already belongs to a set or is not empty. */
+    if (free_slot == NULL)
+    {
+        ret = OSAL_ERR_NO_FREE_IDS;
+    }
+    else if (xQueueAddToSet((QueueSetMemberHandle_t)member_handle, (QueueSetHandle_t)set_handle) == pdPASS)
+    {
+        free_slot->member = (QueueSetMemberHandle_t)member_handle;
+        free_slot->set = (QueueSetHandle_t)set_handle;
+        ret = OSAL_SUCCESS;
+    }
+    else
+    {
+        ret = OSAL_ERR_OBJECT_IN_USE;
+    }
+    taskEXIT_CRITICAL();
+    return ret;
+}
+
+int32_t os_wait_set_add_queue_impl(osal_wait_set_handle_t set_handle, osal_queue_handle_t queue_handle)
+{
+    return os_wait_set_add(set_handle, queue_handle);
+}
+
+int32_t os_wait_set_add_sema_impl(osal_wait_set_handle_t set_handle, osal_sema_handle_t sema_handle)
+{
+    return os_wait_set_add(set_handle, sema_handle);
+}
+
+int32_t os_wait_set_remove_impl(osal_wait_set_handle_t set_handle, void *member_handle)
+{
+    int32_t ret;
+    taskENTER_CRITICAL();
+    if (xQueueRemoveFromSet((QueueSetMemberHandle_t)member_handle, (QueueSetHandle_t)set_handle) == pdPASS)
+    {
+        for (uint32_t i = 0; i < OSAL_WAIT_SET_MAX_MEMBERS; i++)
+        {
+            if (os_wait_members[i].member == (QueueSetMemberHandle_t)member_handle)
+            {
+                os_wait_members[i].member = NULL;
+                os_wait_members[i].set = NULL;
+                break;
+            }
+        }
+        ret = OSAL_SUCCESS;
+    }
+    else
+    {
+        ret = OSAL_ERR_INCORRECT_OBJ_STATE;
+    }
+    taskEXIT_CRITICAL();
+    return ret;
+}
+
+int32_t os_wait_any_impl(osal_wait_set_handle_t set_handle, void **p_ready_handle, osal_tick_type_t timeout)
+{
+    int32_t ret;
+    QueueSetMemberHandle_t member;
+
+    if (OSAL_IS_IN_ISR())
+    {
+        member = xQueueSelectFromSetFromISR((QueueSetHandle_t)set_handle);
+    }
+    else
+    {
+        member = xQueueSelectFromSet((QueueSetHandle_t)set_handle, OS_MS_TO_TICKS(timeout));
+    }
+
+    if (member == NULL)
+    {
+        ret = OSAL_ERROR_TIMEOUT;
+    }
+    else
+    {
+        *p_ready_handle = (void *)member;
+        ret = OSAL_SUCCESS;
+    }
+    return ret;
+}
+
+#else
+
+int32_t os_wait_set_create_impl(size_t max_events, osal_wait_set_handle_t *p_set_handle)
+{
+    (void)max_events;
+    (void)p_set_handle;
+    return OSAL_ERR_NOT_IMPLEMENTED;
+}
+
+int32_t os_wait_set_delete_impl(osal_wait_set_handle_t set_handle)
+{
+    (void)set_handle;
+    return OSAL_ERR_NOT_IMPLEMENTED;
+}
+
+int32_t os_wait_set_add_queue_impl(osal_wait_set_handle_t set_handle, osal_queue_handle_t queue_handle)
+{
+    (void)set_handle;
+    (void)queue_handle;
+    return OSAL_ERR_NOT_IMPLEMENTED;
+}
+
+int32_t os_wait_set_add_sema_impl(osal_wait_set_handle_t set_handle, osal_sema_handle_t sema_handle)
+{
+    (void)set_handle;
+    (void)sema_handle;
+    return OSAL_ERR_NOT_IMPLEMENTED;
+}
+
+int32_t os_wait_set_remove_impl(osal_wait_set_handle_t set_handle, void *member_handle)
+{
+    (void)set_handle;
+    (void)member_handle;
+    return OSAL_ERR_NOT_IMPLEMENTED;
+}
+
+int32_t os_wait_any_impl(osal_wait_set_handle_t set_handle, void **p_ready_handle, osal_tick_type_t timeout)
+{
+    (void)set_handle;
+    (void)p_ready_handle;
+    (void)timeout;
+    return OSAL_ERR_NOT_IMPLEMENTED;
+}
+
+#endif // configUSE_QUEUE_SETS
+
+#endif // OSAL_RTOS_SUPPORT
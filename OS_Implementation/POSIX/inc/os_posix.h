@@ -0,0 +1,104 @@
+#ifndef __OS_POSIX_H__
+#define __OS_POSIX_H__
+
+#include <string.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <errno.h>
+#include <time.h>
+#include <pthread.h>
+#include "osal_config.h"
+#include "osal_internal_time.h"
+
+/* Host tick rate, 1 kHz keeps ticks and milliseconds interchangeable like most target configs. */
+#define OS_POSIX_TICK_RATE_HZ       (1000U)
+
+#define OS_POSIX_NSEC_PER_SEC       (1000000000LL)
+
+#define OS_MS_TO_TICKS(osal_time_in_ms) \
+    osal_time_ms_to_ticks_at((osal_time_in_ms), OS_POSIX_TICK_RATE_HZ)
+
+/* CLOCK_MONOTONIC time of tick 0, taken on the first clock read. */
+void os_posix_epoch_get(struct timespec *p_epoch);
+
+/*
+ * Simulated interrupt context.
+ * Code between os_posix_isr_enter() and os_posix_isr_exit() sees OSAL_IS_IN_ISR() as true,
+ * never blocks inside the OSAL and is serialized against osal_enter_critical() and
+ * osal_task_disable_interrupts() like a real interrupt would be.
+ */
+void os_posix_isr_enter(void);
+
+void os_posix_isr_exit(void);
+
+bool os_posix_is_in_isr(void);
+
+/* Global lock standing in for interrupt masking, shared by every POSIX impl file. */
+void os_posix_critical_lock(void);
+
+void os_posix_critical_unlock(void);
+
+/* Cancellation point used by osal_task_delete() and osal_task_suspend() on other tasks. */
+void os_posix_task_checkpoint(void);
+
+/* Queues and semaphores that can be attached to one osal wait set. */
+#define OS_POSIX_WAIT_SET_MAX_MEMBERS   (16)
+
+/* Records `count` ready events of member in a wait set, called by queue send and semaphore give. */
+void os_posix_wait_set_post(void *set, void *member, size_t count);
+
+/*
+ * Move a queue or semaphore from wait set `expected` to `set`, both may be NULL.
+ * Attaching requires an empty member.
+ */
+int32_t os_posix_queue_wait_set_bind(void *queue_handle, void *set, void *expected);
+
+int32_t os_posix_sema_wait_set_bind(void *sema_handle, void *set, void *expected);
+
+static inline void os_posix_cond_init(pthread_cond_t *p_cond)
+{
+    pthread_condattr_t attr;
+    pthread_condattr_init(&attr);
+    pthread_condattr_setclock(&attr, CLOCK_MONOTONIC);
+    pthread_cond_init(p_cond, &attr);
+    pthread_condattr_destroy(&attr);
+}
+
+static inline void os_posix_timespec_add_ns(struct timespec *p_ts, int64_t ns)
+{
+    int64_t total = (int64_t)p_ts->tv_nsec + ns;
+    p_ts->tv_sec += (time_t)(total / OS_POSIX_NSEC_PER_SEC);
+    p_ts->tv_nsec = (long)(total % OS_POSIX_NSEC_PER_SEC);
+}
+
+static inline int64_t os_posix_ticks_to_ns(osal_tick_type_t ticks)
+{
+    return ((int64_t)ticks * OS_POSIX_NSEC_PER_SEC) / (int64_t)OS_POSIX_TICK_RATE_HZ;
+}
+
+/* Absolute CLOCK_MONOTONIC deadline `ticks` from now. */
+static inline void os_posix_deadline_get(struct timespec *p_deadline, osal_tick_type_t ticks)
+{
+    clock_gettime(CLOCK_MONOTONIC, p_deadline);
+    os_posix_timespec_add_ns(p_deadline, os_posix_ticks_to_ns(ticks));
+}
+
+/*
+ * Wait on a monotonic condition variable with an OSAL tick timeout.
+ * Returns 0 when signalled and ETIMEDOUT once p_deadline has passed, NULL deadline waits forever.
+ */
+static inline int os_posix_cond_wait(pthread_cond_t *p_cond, pthread_mutex_t *p_mutex, const struct timespec *p_deadline)
+{
+    int err;
+    if (p_deadline == NULL)
+    {
+        err = pthread_cond_wait(p_cond, p_mutex);
+    }
+    else
+    {
+        err = pthread_cond_timedwait(p_cond, p_mutex, p_deadline);
+    }
+    return err;
+}
+
+#endif // __OS_POSIX_H__
@@ -0,0 +1,129 @@
+#include "osal_internal_event.h"
+#include "os_posix.h"
+#include "osal_internal_heap.h"
+
+#if (OSAL_RTOS_SUPPORT == POSIX_SUPPORT)
+
+typedef struct
+{
+    pthread_mutex_t lock;
+    pthread_cond_t changed;
+    osal_event_bits_t bits;
+} os_posix_event_t;
+
+int32_t os_event_create_impl(osal_event_handle_t *p_event_handle)
+{
+    int32_t ret;
+    os_posix_event_t *cur_event_handle;
+
+    cur_event_handle = (os_posix_event_t *)os_heap_malloc_impl(sizeof(os_posix_event_t));
+    if (cur_event_handle == NULL)
+    {
+        ret = OSAL_ERROR;
+    }
+    else
+    {
+        pthread_mutex_init(&cur_event_handle->lock, NULL);
+        os_posix_cond_init(&cur_event_handle->changed);
+        cur_event_handle->bits = 0;
+        *p_event_handle = (osal_event_handle_t)cur_event_handle;
+        ret = OSAL_SUCCESS;
+    }
+    return ret;
+}
+
+int32_t os_event_delete_impl(osal_event_handle_t event_handle)
+{
+    os_posix_event_t *handle = (os_posix_event_t *)event_handle;
+    pthread_mutex_destroy(&handle->lock);
+    pthread_cond_destroy(&handle->changed);
+    os_heap_free_impl(handle);
+    return OSAL_SUCCESS;
+}
+
+int32_t os_event_set_impl(osal_event_handle_t event_handle, osal_event_bits_t bits)
+{
+    os_posix_event_t *handle = (os_posix_event_t *)event_handle;
+
+    pthread_mutex_lock(&handle->lock);
+    handle->bits |= bits;
+    /* Waiters test different masks, wake all of them. */
+    pthread_cond_broadcast(&handle->changed);
+    pthread_mutex_unlock(&handle->lock);
+    return OSAL_SUCCESS;
+}
+
+int32_t os_event_clear_impl(osal_event_handle_t event_handle, osal_event_bits_t bits)
+{
+    os_posix_event_t *handle = (os_posix_event_t *)event_handle;
+
+    pthread_mutex_lock(&handle->lock);
+    handle->bits &= ~bits;
+    pthread_mutex_unlock(&handle->lock);
+    return OSAL_SUCCESS;
+}
+
+static bool os_event_satisfied(osal_event_bits_t value, osal_event_bits_t bits, uint32_t options)
+{
+    if ((options & OSAL_EVENT_WAIT_ALL) != 0U)
+    {
+        return (value & bits) == bits;
+    }
+    return (value & bits) != 0U;
+}
+
+int32_t os_event_wait_impl(osal_event_handle_t event_handle, osal_event_bits_t bits, uint32_t options,
+                           osal_event_bits_t *p_bits, osal_tick_type_t timeout)
+{
+    int32_t ret;
+    int err = 0;
+    struct timespec deadline;
+    os_posix_event_t *handle = (os_posix_event_t *)event_handle;
+    osal_tick_type_t ticks = OS_MS_TO_TICKS(timeout);
+
+    if (OSAL_IS_IN_ISR())
+    {
+        return OSAL_ERR_IN_ISR;
+    }
+    if (ticks != 0U && ticks != OSAL_MAX_DELAY)
+    {
+        os_posix_deadline_get(&deadline, ticks);
+    }
+
+    pthread_mutex_lock(&handle->lock);
+    while (!os_event_satisfied(handle->bits, bits, options) && ticks != 0U && err == 0)
+    {
+        err = os_posix_cond_wait(&handle->changed, &handle->lock, (ticks == OSAL_MAX_DELAY) ? NULL : &deadline);
+    }
+    if (p_bits != NULL)
+    {
+        *p_bits = handle->bits;
+    }
+    if (os_event_satisfied(handle->bits, bits, options))
+    {
+        if ((options & OSAL_EVENT_CLEAR_ON_EXIT) != 0U)
+        {
+            handle->bits &= ~bits;
+        }
+        ret = OSAL_SUCCESS;
+    }
+    else
+    {
+        ret = OSAL_ERROR_TIMEOUT;
+    }
+    pthread_mutex_unlock(&handle->lock);
+    return ret;
+}
+
+osal_event_bits_t os_event_get_impl(osal_event_handle_t event_handle)
+{
+    osal_event_bits_t bits;
+    os_posix_event_t *handle = (os_posix_event_t *)event_handle;
+
+    pthread_mutex_lock(&handle->lock);
+    bits = handle->bits;
+    pthread_mutex_unlock(&handle->lock);
+    return bits;
+}
+
+#endif // OSAL_RTOS_SUPPORT
@@ -0,0 +1,102 @@
+#define OSAL_HEAP_IMPL_SOURCE
+#include "osal_internal_heap.h"
+#include "osal_internal_tlsf.h"
+#include "osal_internal_atomic.h"
+#include "os_posix.h"
+#include <stdlib.h>
+
+#if (OSAL_RTOS_SUPPORT == POSIX_SUPPORT)
+
+#if (OSAL_HEAP_USE_TLSF == 1)
+
+void os_heap_init_impl(void)
+{
+    osal_tlsf_heap_init();
+}
+
+void *os_heap_malloc_impl(size_t wanted_size)
+{
+    return osal_tlsf_heap_malloc(wanted_size);
+}
+
+void *os_heap_malloc_aligned_impl(size_t wanted_size, size_t align)
+{
+    return osal_tlsf_heap_memalign(wanted_size, align);
+}
+
+void os_heap_free_impl(void *ptr)
+{
+    osal_tlsf_heap_free(ptr);
+}
+
+void os_heap_get_stats_impl(osal_heap_stats_t *p_stats)
+{
+    osal_tlsf_heap_get_stats(p_stats);
+}
+
+size_t os_heap_get_free_impl(void)
+{
+    return osal_tlsf_heap_get_free();
+}
+
+#else
+
+static osal_atomic_u32_t os_heap_alloc_count;
+static osal_atomic_u32_t os_heap_free_count;
+static osal_atomic_u32_t os_heap_failed_count;
+
+void os_heap_init_impl(void)
+{
+}
+
+void *os_heap_malloc_impl(size_t wanted_size)
+{
+    void *ptr = malloc(wanted_size);
+    osal_atomic_fetch_add((ptr != NULL) ? &os_heap_alloc_count : &os_heap_failed_count, 1U);
+    if (ptr == NULL)
+    {
+        osal_heap_report_failure(wanted_size);
+    }
+    return ptr;
+}
+
+void *os_heap_malloc_aligned_impl(size_t wanted_size, size_t align)
+{
+    void *ptr = NULL;
+    if (posix_memalign(&ptr, (align < sizeof(void *)) ? sizeof(void *) : align, wanted_size) != 0)
+    {
+        ptr = NULL;
+    }
+    osal_atomic_fetch_add((ptr != NULL) ? &os_heap_alloc_count : &os_heap_failed_count, 1U);
+    if (ptr == NULL)
+    {
+        osal_heap_report_failure(wanted_size);
+    }
+    return ptr;
+}
+
+void os_heap_free_impl(void *ptr)
+{
+    if (ptr != NULL)
+    {
+        osal_atomic_fetch_add(&os_heap_free_count, 1U);
+        free(ptr);
+    }
+}
+
+/* The host heap has no fixed size, only the counters are meaningful. */
+void os_heap_get_stats_impl(osal_heap_stats_t *p_stats)
+{
+    p_stats->alloc_count = osal_atomic_load_relaxed(&os_heap_alloc_count);
+    p_stats->free_count = osal_atomic_load_relaxed(&os_heap_free_count);
+    p_stats->failed_count = osal_atomic_load_relaxed(&os_heap_failed_count);
+}
+
+size_t os_heap_get_free_impl(void)
+{
+    return SIZE_MAX;
+}
+
+#endif // OSAL_HEAP_USE_TLSF
+
+#endif // OSAL_RTOS_SUPPORT
@@ -0,0 +1,134 @@
+#ifndef _GNU_SOURCE
+#define _GNU_SOURCE
+#endif
+#include "osal_internal_mutex.h"
+#include "os_posix.h"
+#include "osal_internal_heap.h"
+
+#if (OSAL_RTOS_SUPPORT == POSIX_SUPPORT)
+
+/* mutex stays the first member, give/take use the handle as a pthread_mutex_t *. */
+typedef struct
+{
+    pthread_mutex_t mutex;
+    bool cb_allocated;
+} os_posix_mutex_t;
+
+OSAL_STATIC_ASSERT(sizeof(osal_mutex_static_t) >= sizeof(os_posix_mutex_t), mutex_static_size);
+
+static int32_t os_mutex_create(osal_mutex_handle_t *p_mutex_handle, void *cb_memory)
+{
+    int32_t ret;
+    os_posix_mutex_t *cur_mutex_handle;
+    pthread_mutexattr_t attr;
+
+    cur_mutex_handle = (os_posix_mutex_t *)cb_memory;
+    if (cur_mutex_handle == NULL)
+    {
+        cur_mutex_handle = (os_posix_mutex_t *)os_heap_malloc_impl(sizeof(os_posix_mutex_t));
+    }
+    if (cur_mutex_handle == NULL)
+    {
+        ret = OSAL_ERROR;
+    }
+    else
+    {
+        /* Error checking makes a give from a non-owner fail, as it does on the RTOS backends. */
+        pthread_mutexattr_init(&attr);
+        pthread_mutexattr_settype(&attr, PTHREAD_MUTEX_ERRORCHECK);
+        int err = pthread_mutex_init(&cur_mutex_handle->mutex, &attr);
+        pthread_mutexattr_destroy(&attr);
+        cur_mutex_handle->cb_allocated = (cb_memory == NULL);
+        if (err != 0)
+        {
+            if (cur_mutex_handle->cb_allocated)
+            {
+                os_heap_free_impl(cur_mutex_handle);
+            }
+            ret = OSAL_ERROR;
+        }
+        else
+        {
+            *p_mutex_handle = (osal_mutex_handle_t)cur_mutex_handle;
+            ret = OSAL_SUCCESS;
+        }
+    }
+    return ret;
+}
+
+int32_t os_mutex_create_impl(osal_mutex_handle_t *p_mutex_handle)
+{
+    return os_mutex_create(p_mutex_handle, NULL);
+}
+
+int32_t os_mutex_create_static_impl(osal_mutex_handle_t *p_mutex_handle, void *cb_memory)
+{
+    return os_mutex_create(p_mutex_handle, cb_memory);
+}
+
+void os_mutex_delete_impl(osal_mutex_handle_t mutex_handle)
+{
+    os_posix_mutex_t *handle = (os_posix_mutex_t *)mutex_handle;
+    if (handle != NULL)
+    {
+        pthread_mutex_destroy(&handle->mutex);
+        if (handle->cb_allocated)
+        {
+            os_heap_free_impl(handle);
+        }
+    }
+}
+
+int32_t os_mutex_give_impl(osal_mutex_handle_t mutex_handle)
+{
+    int32_t ret;
+    pthread_mutex_t *handle = (pthread_mutex_t *)mutex_handle;
+
+    OSAL_CHECK_POINTER(handle);
+
+    if (pthread_mutex_unlock(handle) == 0)
+    {
+        ret = OSAL_SUCCESS;
+    }
+    else
+    {
+        ret = OSAL_ERROR;
+    }
+    return ret;
+}
+
+int32_t os_mutex_take_impl(osal_mutex_handle_t mutex_handle, osal_tick_type_t timeout)
+{
+    int32_t ret;
+    int err;
+    pthread_mutex_t *handle = (pthread_mutex_t *)mutex_handle;
+    osal_tick_type_t ticks = OS_MS_TO_TICKS(timeout);
+    OSAL_CHECK_POINTER(handle);
+
+    if (OSAL_IS_IN_ISR() || ticks == 0U)
+    {
+        err = pthread_mutex_trylock(handle);
+    }
+    else if (ticks == OSAL_MAX_DELAY)
+    {
+        err = pthread_mutex_lock(handle);
+    }
+    else
+    {
+        struct timespec deadline;
+        os_posix_deadline_get(&deadline, ticks);
+        err = pthread_mutex_clocklock(handle, CLOCK_MONOTONIC, &deadline);
+    }
+
+    if (err == 0)
+    {
+        ret = OSAL_SUCCESS;
+    }
+    else
+    {
+        ret = OSAL_ERROR;
+    }
+    return ret;
+}
+
+#endif // OSAL_RTOS_SUPPORT
@@ -0,0 +1,33 @@
+#include "osal_internal_pool.h"
+#include "os_posix.h"
+//#include "app_log.h"
+
+#if (OSAL_RTOS_SUPPORT == POSIX_SUPPORT)
+
+/* No native block pool, use the shared lock-free freelist. */
+int32_t os_pool_create_impl(size_t block_size, uint32_t block_count, osal_pool_handle_t *p_pool_handle)
+{
+    return osal_freelist_pool_create(block_size, block_count, p_pool_handle);
+}
+
+int32_t os_pool_delete_impl(osal_pool_handle_t pool_handle)
+{
+    return osal_freelist_pool_delete(pool_handle);
+}
+
+void *os_pool_alloc_impl(osal_pool_handle_t pool_handle, osal_tick_type_t timeout)
+{
+    return osal_freelist_pool_alloc(pool_handle, timeout);
+}
+
+int32_t os_pool_free_impl(osal_pool_handle_t pool_handle, void *block)
+{
+    return osal_freelist_pool_free(pool_handle, block);
+}
+
+void os_pool_get_stats_impl(osal_pool_handle_t pool_handle, osal_pool_stats_t *p_stats)
+{
+    osal_freelist_pool_get_stats(pool_handle, p_stats);
+}
+
+#endif // OSAL_RTOS_SUPPORT
@@ -0,0 +1,282 @@
+#include "osal_internal_queue.h"
+#include "os_posix.h"
+#include "osal_internal_heap.h"
+
+#if (OSAL_RTOS_SUPPORT == POSIX_SUPPORT)
+
+/* Control block and message storage live in one allocation, storage follows the struct. */
+typedef struct
+{
+    pthread_mutex_t lock;
+    pthread_cond_t not_empty;
+    pthread_cond_t not_full;
+    size_t queue_depth;
+    size_t data_size;
+    size_t head;
+    size_t count;
+    void *wait_set;
+    bool cb_allocated;
+    uint8_t *storage;
+} os_posix_queue_t;
+
+OSAL_STATIC_ASSERT(sizeof(osal_queue_static_t) >= sizeof(os_posix_queue_t), queue_static_size);
+
+static void os_queue_init(os_posix_queue_t *handle, size_t queue_depth, size_t data_size, uint8_t *storage, bool cb_allocated)
+{
+    pthread_mutex_init(&handle->lock, NULL);
+    os_posix_cond_init(&handle->not_empty);
+    os_posix_cond_init(&handle->not_full);
+    handle->queue_depth = queue_depth;
+    handle->data_size = data_size;
+    handle->head = 0;
+    handle->count = 0;
+    handle->wait_set = NULL;
+    handle->cb_allocated = cb_allocated;
+    handle->storage = storage;
+}
+
+int32_t os_queue_create_impl( size_t queue_depth, size_t data_size, osal_queue_handle_t *p_queue_handle)
+{
+    int32_t ret;
+    os_posix_queue_t *cur_queue_handle;
+
+    OSAL_CHECK_POINTER(p_queue_handle);
+    OSAL_CHECK_SIZE(queue_depth);
+    OSAL_CHECK_SIZE(data_size);
+
+    cur_queue_handle = (os_posix_queue_t *)os_heap_malloc_impl(sizeof(os_posix_queue_t) + queue_depth * data_size);
+    if (cur_queue_handle == NULL)
+    {
+        ret = OSAL_ERROR;
+    }
+    else
+    {
+        os_queue_init(cur_queue_handle, queue_depth, data_size, (uint8_t *)(cur_queue_handle + 1), true);
+        *p_queue_handle = (osal_queue_handle_t)cur_queue_handle;
+        ret = OSAL_SUCCESS;
+    }
+    return ret;
+}
+
+int32_t os_queue_create_static_impl(size_t queue_depth, size_t data_size, void *storage, void *cb_memory, osal_queue_handle_t *p_queue_handle)
+{
+    os_posix_queue_t *cur_queue_handle = (os_posix_queue_t *)cb_memory;
+    os_queue_init(cur_queue_handle, queue_depth, data_size, (uint8_t *)storage, false);
+    *p_queue_handle = (osal_queue_handle_t)cur_queue_handle;
+    return OSAL_SUCCESS;
+}
+
+void os_queue_delete_impl(osal_queue_handle_t queue_handle)
+{
+    os_posix_queue_t *handle = (os_posix_queue_t *)queue_handle;
+    if (handle != NULL)
+    {
+        pthread_mutex_destroy(&handle->lock);
+        pthread_cond_destroy(&handle->not_empty);
+        pthread_cond_destroy(&handle->not_full);
+        if (handle->cb_allocated)
+        {
+            os_heap_free_impl(handle);
+        }
+    }
+}
+
+/* Waits on p_cond until `ready` holds or the timeout expires, called with the queue lock held. */
+#define OS_QUEUE_WAIT(handle, p_cond, ready, ticks, err)                                   \
+    do                                                                                     \
+    {                                                                                      \
+        struct timespec deadline;                                                          \
+        if ((ticks) != 0U && (ticks) != OSAL_MAX_DELAY)                                    \
+        {                                                                                  \
+            os_posix_deadline_get(&deadline, (ticks));                                     \
+        }                                                                                  \
+        while (!(ready) && (ticks) != 0U && (err) == 0)                                    \
+        {                                                                                  \
+            (err) = os_posix_cond_wait((p_cond), &(handle)->lock,                          \
+                                       ((ticks) == OSAL_MAX_DELAY) ? NULL : &deadline);    \
+        }                                                                                  \
+    } while (0)
+
+int32_t os_queue_send_impl(osal_queue_handle_t queue_handle, const void *data, osal_tick_type_t timeout)
+{
+    int32_t ret;
+    int err = 0;
+    os_posix_queue_t *handle = (os_posix_queue_t *)queue_handle;
+    osal_tick_type_t ticks = OS_MS_TO_TICKS(timeout);
+
+    OSAL_CHECK_POINTER(queue_handle);
+    OSAL_CHECK_POINTER(data);
+
+    if (OSAL_IS_IN_ISR())
+    {
+        ticks = 0U;
+    }
+
+    pthread_mutex_lock(&handle->lock);
+    OS_QUEUE_WAIT(handle, &handle->not_full, handle->count < handle->queue_depth, ticks, err);
+    if (handle->count < handle->queue_depth)
+    {
+        size_t tail = (handle->head + handle->count) % handle->queue_depth;
+        memcpy(&handle->storage[tail * handle->data_size], data, handle->data_size);
+        handle->count++;
+        pthread_cond_signal(&handle->not_empty);
+        if (handle->wait_set != NULL)
+        {
+            os_posix_wait_set_post(handle->wait_set, handle, 1U);
+        }
+        ret = OSAL_SUCCESS;
+    }
+    else
+    {
+        ret = OSAL_ERROR;
+    }
+    pthread_mutex_unlock(&handle->lock);
+    return ret;
+}
+
+int32_t os_queue_receive_impl(osal_queue_handle_t queue_handle, void *data, osal_tick_type_t timeout)
+{
+    int32_t ret;
+    int err = 0;
+    os_posix_queue_t *handle = (os_posix_queue_t *)queue_handle;
+    osal_tick_type_t ticks = OS_MS_TO_TICKS(timeout);
+    OSAL_CHECK_POINTER(handle);
+    OSAL_CHECK_POINTER(data);
+
+    if (OSAL_IS_IN_ISR())
+    {
+        ticks = 0U;
+    }
+
+    pthread_mutex_lock(&handle->lock);
+    OS_QUEUE_WAIT(handle, &handle->not_empty, handle->count != 0U, ticks, err);
+    if (handle->count != 0U)
+    {
+        memcpy(data, &handle->storage[handle->head * handle->data_size], handle->data_size);
+        handle->head = (handle->head + 1U) % handle->queue_depth;
+        handle->count--;
+        pthread_cond_signal(&handle->not_full);
+        ret = OSAL_SUCCESS;
+    }
+    else
+    {
+        ret = OSAL_ERROR;
+    }
+    pthread_mutex_unlock(&handle->lock);
+    return ret;
+}
+
+int32_t os_queue_msg_waiting_impl(osal_queue_handle_t queue_handle)
+{
+    int32_t ret;
+    os_posix_queue_t *handle = (os_posix_queue_t *)queue_handle;
+
+    if (handle != NULL)
+    {
+        pthread_mutex_lock(&handle->lock);
+        ret = (int32_t)handle->count;
+        pthread_mutex_unlock(&handle->lock);
+    }
+    else
+    {
+        ret = 0;
+    }
+    return ret;
+}
+
+size_t os_queue_send_many_impl(osal_queue_handle_t queue_handle, const void *data, size_t data_size, size_t count, osal_tick_type_t timeout)
+{
+    size_t sent = 0;
+    int err = 0;
+    const uint8_t *p_data = (const uint8_t *)data;
+    os_posix_queue_t *handle = (os_posix_queue_t *)queue_handle;
+    osal_tick_type_t ticks = OS_MS_TO_TICKS(timeout);
+
+    if (handle == NULL || data == NULL || count == 0U || data_size != handle->data_size)
+    {
+        return 0;
+    }
+    if (OSAL_IS_IN_ISR())
+    {
+        ticks = 0U;
+    }
+
+    pthread_mutex_lock(&handle->lock);
+    OS_QUEUE_WAIT(handle, &handle->not_full, handle->count < handle->queue_depth, ticks, err);
+    while (sent < count && handle->count < handle->queue_depth)
+    {
+        size_t tail = (handle->head + handle->count) % handle->queue_depth;
+        memcpy(&handle->storage[tail * data_size], &p_data[sent * data_size], data_size);
+        handle->count++;
+        sent++;
+    }
+    if (sent != 0U)
+    {
+        pthread_cond_broadcast(&handle->not_empty);
+        if (handle->wait_set != NULL)
+        {
+            os_posix_wait_set_post(handle->wait_set, handle, sent);
+        }
+    }
+    pthread_mutex_unlock(&handle->lock);
+    return sent;
+}
+
+size_t os_queue_receive_many_impl(osal_queue_handle_t queue_handle, void *data, size_t data_size, size_t count, osal_tick_type_t timeout)
+{
+    size_t received = 0;
+    int err = 0;
+    uint8_t *p_data = (uint8_t *)data;
+    os_posix_queue_t *handle = (os_posix_queue_t *)queue_handle;
+    osal_tick_type_t ticks = OS_MS_TO_TICKS(timeout);
+
+    if (handle == NULL || data == NULL || count == 0U || data_size != handle->data_size)
+    {
+        return 0;
+    }
+    if (OSAL_IS_IN_ISR())
+    {
+        ticks = 0U;
+    }
+
+    pthread_mutex_lock(&handle->lock);
+    OS_QUEUE_WAIT(handle, &handle->not_empty, handle->count != 0U, ticks, err);
+    while (received < count && handle->count != 0U)
+    {
+        memcpy(&p_data[received * data_size], &handle->storage[handle->head * data_size], data_size);
+        handle->head = (handle->head + 1U) % handle->queue_depth;
+        handle->count--;
+        received++;
+    }
+    if (received != 0U)
+    {
+        pthread_cond_broadcast(&handle->not_full);
+    }
+    pthread_mutex_unlock(&handle->lock);
+    return received;
+}
+
+int32_t os_posix_queue_wait_set_bind(void *queue_handle, void *set, void *expected)
+{
+    int32_t ret;
+    os_posix_queue_t *handle = (os_posix_queue_t *)queue_handle;
+
+    pthread_mutex_lock(&handle->lock);
+    if (handle->wait_set != expected)
+    {
+        ret = (set != NULL) ? OSAL_ERR_OBJECT_IN_USE : OSAL_ERR_INCORRECT_OBJ_STATE;
+    }
+    else if (set != NULL && handle->count != 0U)
+    {
+        ret = OSAL_ERR_INCORRECT_OBJ_STATE;
+    }
+    else
+    {
+        handle->wait_set = set;
+        ret = OSAL_SUCCESS;
+    }
+    pthread_mutex_unlock(&handle->lock);
+    return ret;
+}
+
+#endif // OSAL_RTOS_SUPPORT
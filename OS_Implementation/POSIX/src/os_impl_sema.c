@@ -0,0 +1,187 @@
+#include "osal_internal_sema.h"
+#include "os_posix.h"
+#include "osal_internal_heap.h"
+#include <stdatomic.h>
+#include <limits.h>
+#include <unistd.h>
+#include <sys/syscall.h>
+#include <linux/futex.h>
+
+#if (OSAL_RTOS_SUPPORT == POSIX_SUPPORT)
+
+/*
+ * Futex based semaphore
+ * The uncontended give/take path is a single compare-and-swap, the kernel is only entered
+ * to sleep on an empty count or to wake a sleeper.
+ */
+typedef struct
+{
+    atomic_uint count;
+    atomic_uint waiters;
+    uint32_t max_count;  // Max count: 1 for binary, custom for counting
+    _Atomic(void *) wait_set;
+    bool cb_allocated;
+} os_sema_futex_t;
+
+OSAL_STATIC_ASSERT(sizeof(osal_sema_static_t) >= sizeof(os_sema_futex_t), sema_static_size);
+
+static int os_futex_wait(atomic_uint *p_word, uint32_t expected, const struct timespec *p_deadline)
+{
+    /* FUTEX_WAIT_BITSET takes an absolute CLOCK_MONOTONIC deadline. */
+    return (int)syscall(SYS_futex, p_word, FUTEX_WAIT_BITSET | FUTEX_PRIVATE_FLAG, expected,
+                        p_deadline, NULL, FUTEX_BITSET_MATCH_ANY);
+}
+
+static void os_futex_wake(atomic_uint *p_word, int count)
+{
+    syscall(SYS_futex, p_word, FUTEX_WAKE | FUTEX_PRIVATE_FLAG, count, NULL, NULL, 0);
+}
+
+static int32_t os_sema_create(osal_sema_handle_t *p_sema_handle, uint32_t max_count, uint32_t init_count, void *cb_memory)
+{
+    int32_t ret;
+    os_sema_futex_t *sema;
+
+    OSAL_CHECK_POINTER(p_sema_handle);
+    ARGCHECK(max_count > 0U && init_count <= max_count, OSAL_INVALID_SEM_VALUE);
+
+    sema = (os_sema_futex_t *)cb_memory;
+    if (sema == NULL)
+    {
+        sema = (os_sema_futex_t *)os_heap_malloc_impl(sizeof(os_sema_futex_t));
+    }
+    if (sema == NULL)
+    {
+        ret = OSAL_ERROR;
+    }
+    else
+    {
+        atomic_init(&sema->count, init_count);
+        atomic_init(&sema->waiters, 0U);
+        sema->max_count = max_count;
+        atomic_init(&sema->wait_set, NULL);
+        sema->cb_allocated = (cb_memory == NULL);
+        *p_sema_handle = (osal_sema_handle_t)sema;
+        ret = OSAL_SUCCESS;
+    }
+    return ret;
+}
+
+int32_t os_sema_binary_create_impl(osal_sema_handle_t *p_sema_handle)
+{
+    return os_sema_create(p_sema_handle, 1U, 0U, NULL);
+}
+
+int32_t os_sema_countings_create_impl(osal_sema_handle_t *p_sema_handle, uint32_t max_count, uint32_t init_count)
+{
+    return os_sema_create(p_sema_handle, max_count, init_count, NULL);
+}
+
+int32_t os_sema_binary_create_static_impl(osal_sema_handle_t *p_sema_handle, void *cb_memory)
+{
+    return os_sema_create(p_sema_handle, 1U, 0U, cb_memory);
+}
+
+int32_t os_sema_countings_create_static_impl(osal_sema_handle_t *p_sema_handle, uint32_t max_count, uint32_t init_count, void *cb_memory)
+{
+    return os_sema_create(p_sema_handle, max_count, init_count, cb_memory);
+}
+
+void os_sema_delete_impl(osal_sema_handle_t sema_handle)
+{
+    os_sema_futex_t *sema = (os_sema_futex_t *)sema_handle;
+    if (sema != NULL && sema->cb_allocated)
+    {
+        os_heap_free_impl(sema);
+    }
+}
+
+int32_t os_sema_give_impl(osal_sema_handle_t sema_handle)
+{
+    os_sema_futex_t *sema = (os_sema_futex_t *)sema_handle;
+    OSAL_CHECK_POINTER(sema);
+
+    uint32_t count = atomic_load(&sema->count);
+    do
+    {
+        if (count >= sema->max_count)
+        {
+            return OSAL_ERROR;
+        }
+    } while (!atomic_compare_exchange_weak(&sema->count, &count, count + 1U));
+
+    if (atomic_load(&sema->waiters) != 0U)
+    {
+        os_futex_wake(&sema->count, 1);
+    }
+
+    void *wait_set = atomic_load(&sema->wait_set);
+    if (wait_set != NULL)
+    {
+        os_posix_wait_set_post(wait_set, sema, 1U);
+    }
+    return OSAL_SUCCESS;
+}
+
+int32_t os_sema_take_impl(osal_sema_handle_t sema_handle, osal_tick_type_t timeout)
+{
+    int32_t ret = OSAL_ERROR;
+    os_sema_futex_t *sema = (os_sema_futex_t *)sema_handle;
+    osal_tick_type_t ticks = OS_MS_TO_TICKS(timeout);
+    struct timespec deadline;
+    OSAL_CHECK_POINTER(sema);
+
+    if (OSAL_IS_IN_ISR())
+    {
+        ticks = 0U;
+    }
+    if (ticks != 0U && ticks != OSAL_MAX_DELAY)
+    {
+        os_posix_deadline_get(&deadline, ticks);
+    }
+
+    for (;;)
+    {
+        uint32_t count = atomic_load(&sema->count);
+        if (count != 0U)
+        {
+            if (atomic_compare_exchange_weak(&sema->count, &count, count - 1U))
+            {
+                ret = OSAL_SUCCESS;
+                break;
+            }
+            continue;
+        }
+        if (ticks == 0U)
+        {
+            break;
+        }
+
+        atomic_fetch_add(&sema->waiters, 1U);
+        int err = os_futex_wait(&sema->count, 0U, (ticks == OSAL_MAX_DELAY) ? NULL : &deadline);
+        atomic_fetch_sub(&sema->waiters, 1U);
+        if (err != 0 && errno == ETIMEDOUT)
+        {
+            /* One last non-blocking attempt, a give may have raced the timeout. */
+            ticks = 0U;
+        }
+    }
+    return ret;
+}
+
+int32_t os_posix_sema_wait_set_bind(void *sema_handle, void *set, void *expected)
+{
+    os_sema_futex_t *sema = (os_sema_futex_t *)sema_handle;
+
+    if (set != NULL && atomic_load(&sema->count) != 0U)
+    {
+        return OSAL_ERR_INCORRECT_OBJ_STATE;
+    }
+    if (!atomic_compare_exchange_strong(&sema->wait_set, &expected, set))
+    {
+        return (set != NULL) ? OSAL_ERR_OBJECT_IN_USE : OSAL_ERR_INCORRECT_OBJ_STATE;
+    }
+    return OSAL_SUCCESS;
+}
+
+#endif // OSAL_RTOS_SUPPORT
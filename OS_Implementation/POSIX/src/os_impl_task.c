@@ -0,0 +1,761 @@
+#ifndef _GNU_SOURCE
+#define _GNU_SOURCE
+#endif
+#include "osal_internal_task.h"
+#include "os_posix.h"
+#include "osal_internal_heap.h"
+#include <sched.h>
+#include <stdio.h>
+#include <unistd.h>
+#include <sys/syscall.h>
+
+#if (OSAL_RTOS_SUPPORT == POSIX_SUPPORT)
+
+#define OSAL_CHECK_APINAME(str) OSAL_CHECK_STRING(str, configMAX_TASK_NAME_LEN, OSAL_ERR_NAME_TOO_LONG)
+
+typedef struct os_posix_task_handle
+{
+    struct os_posix_task_handle *next;   // os_task_list
+    pthread_t thread;
+    pid_t tid;                           // kernel thread id, 0 until the thread runs
+    osal_core_mask_t core_mask;          // applied by the thread itself when it starts
+    char task_name[configMAX_TASK_NAME_LEN];
+    osal_priority_t priority;
+    osal_task_entry entry_function_pointer;
+    void *entry_arg;
+    pthread_mutex_t lock;
+    pthread_cond_t cond;
+    bool suspended;
+    bool exited;
+    bool deleted;                        // osal_task_delete() sent a cancel, the thread frees the handle
+    uint32_t notify_value;
+    bool notify_pending;
+    bool cb_allocated;
+    void *tls[OSAL_TASK_TLS_COUNT];
+} osal_posix_task_handle_t;
+
+OSAL_STATIC_ASSERT(sizeof(osal_task_static_t) >= sizeof(osal_posix_task_handle_t), task_static_size);
+
+static pthread_mutex_t os_critical_mutex = PTHREAD_RECURSIVE_MUTEX_INITIALIZER_NP;
+
+static pthread_mutex_t os_sched_mutex = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t os_sched_cond = PTHREAD_COND_INITIALIZER;
+static bool os_sched_started = false;
+
+static pthread_once_t os_epoch_once = PTHREAD_ONCE_INIT;
+static struct timespec os_epoch;
+
+/* Every OSAL task until os_task_cleanup(), for osal_task_list_stats(). */
+static pthread_mutex_t os_task_list_lock = PTHREAD_MUTEX_INITIALIZER;
+static osal_posix_task_handle_t *os_task_list = NULL;
+
+static __thread osal_posix_task_handle_t *os_current_task = NULL;
+static __thread uint32_t os_isr_nesting = 0U;
+static __thread uint32_t os_irq_disable_nesting = 0U;
+static __thread uint32_t os_sched_lock_depth = 0U;
+
+static void os_epoch_init(void)
+{
+    clock_gettime(CLOCK_MONOTONIC, &os_epoch);
+}
+
+void os_posix_epoch_get(struct timespec *p_epoch)
+{
+    pthread_once(&os_epoch_once, os_epoch_init);
+    *p_epoch = os_epoch;
+}
+
+void os_posix_critical_lock(void)
+{
+    pthread_mutex_lock(&os_critical_mutex);
+}
+
+void os_posix_critical_unlock(void)
+{
+    pthread_mutex_unlock(&os_critical_mutex);
+}
+
+void os_posix_isr_enter(void)
+{
+    os_posix_critical_lock();
+    os_isr_nesting++;
+}
+
+void os_posix_isr_exit(void)
+{
+    if (os_isr_nesting > 0U)
+    {
+        os_isr_nesting--;
+        os_posix_critical_unlock();
+    }
+}
+
+bool os_posix_is_in_isr(void)
+{
+    return (os_isr_nesting != 0U);
+}
+
+/* Blocks while the calling task is suspended and acts on a pending osal_task_delete(). */
+void os_posix_task_checkpoint(void)
+{
+    osal_posix_task_handle_t *handle = os_current_task;
+    if (handle != NULL)
+    {
+        pthread_mutex_lock(&handle->lock);
+        while (handle->suspended)
+        {
+            pthread_cond_wait(&handle->cond, &handle->lock);
+        }
+        pthread_mutex_unlock(&handle->lock);
+
+        pthread_setcancelstate(PTHREAD_CANCEL_ENABLE, NULL);
+        pthread_testcancel();
+        pthread_setcancelstate(PTHREAD_CANCEL_DISABLE, NULL);
+    }
+}
+
+static void os_task_cleanup(void *arg)
+{
+    osal_posix_task_handle_t *handle = (osal_posix_task_handle_t *)arg;
+
+    /* A deleter may still hold the lock right after its pthread_cancel(). */
+    pthread_mutex_lock(&handle->lock);
+    pthread_mutex_unlock(&handle->lock);
+
+    pthread_mutex_lock(&os_task_list_lock);
+    for (osal_posix_task_handle_t **pp = &os_task_list; *pp != NULL; pp = &(*pp)->next)
+    {
+        if (*pp == handle)
+        {
+            *pp = handle->next;
+            break;
+        }
+    }
+    pthread_mutex_unlock(&os_task_list_lock);
+
+#if (OSAL_HEAP_CACHE_ENABLE == 1)
+    /* The thread is ending or gone, nothing allocates from its cache any more. */
+    osal_heap_cache_release(handle->tls[OSAL_TASK_TLS_HEAP_CACHE]);
+#endif
+    pthread_mutex_destroy(&handle->lock);
+    pthread_cond_destroy(&handle->cond);
+    if (handle->cb_allocated)
+    {
+        os_heap_free_impl(handle);
+    }
+}
+
+static void os_task_affinity_apply(pid_t tid, osal_core_mask_t core_mask)
+{
+    cpu_set_t set;
+    if (core_mask == OSAL_CORE_MASK_ANY)
+    {
+        return;
+    }
+    CPU_ZERO(&set);
+    for (uint32_t core = 0; core < 32U; core++)
+    {
+        if ((core_mask & OSAL_CORE_MASK(core)) != 0U)
+        {
+            CPU_SET(core, &set);
+        }
+    }
+    (void)sched_setaffinity(tid, sizeof(set), &set);
+}
+
+static void *os_task_entry_wrapper(void *arg)
+{
+    osal_posix_task_handle_t *handle = (osal_posix_task_handle_t *)arg;
+
+    /* Tasks only die at OSAL checkpoints, never while holding a queue or sema lock. */
+    pthread_setcancelstate(PTHREAD_CANCEL_DISABLE, NULL);
+    os_current_task = handle;
+    pthread_mutex_lock(&handle->lock);
+    handle->tid = (pid_t)syscall(SYS_gettid);
+    os_task_affinity_apply(handle->tid, handle->core_mask);
+    pthread_mutex_unlock(&handle->lock);
+
+    pthread_mutex_lock(&os_sched_mutex);
+    while (!os_sched_started)
+    {
+        pthread_cond_wait(&os_sched_cond, &os_sched_mutex);
+    }
+    pthread_mutex_unlock(&os_sched_mutex);
+
+    pthread_cleanup_push(os_task_cleanup, handle);
+    os_posix_task_checkpoint();
+    handle->entry_function_pointer(handle->entry_arg);
+    pthread_cleanup_pop(0);
+
+    /* A cancel that arrived after the last checkpoint is never acted on, clean up here instead. */
+    pthread_mutex_lock(&handle->lock);
+    bool deleted = handle->deleted;
+    handle->exited = true;
+    pthread_mutex_unlock(&handle->lock);
+    if (deleted)
+    {
+        os_task_cleanup(handle);
+    }
+    return NULL;
+}
+
+int32_t os_task_create_impl(osal_task_internal_record_t *p_task)
+{
+    int32_t ret = OSAL_SUCCESS;
+    OSAL_CHECK_APINAME(p_task->task_name);
+
+    pthread_once(&os_epoch_once, os_epoch_init);
+
+    /* A static stack buffer is accepted but unused, host threads keep their default stack. */
+    osal_posix_task_handle_t *handle = (osal_posix_task_handle_t *)p_task->cb_memory;
+    if (handle == NULL)
+    {
+        handle = (osal_posix_task_handle_t *)os_heap_malloc_impl(sizeof(osal_posix_task_handle_t));
+        if (handle == NULL)
+        {
+            return OSAL_ERROR;
+        }
+    }
+    memset(handle, 0, sizeof(osal_posix_task_handle_t));
+    handle->cb_allocated = (p_task->cb_memory == NULL);
+    memcpy(handle->task_name, p_task->task_name, sizeof(handle->task_name));
+    handle->priority = p_task->priority;
+    handle->entry_function_pointer = p_task->entry_function_pointer;
+    handle->entry_arg = p_task->entry_arg;
+    handle->core_mask = p_task->core_mask;
+    pthread_mutex_init(&handle->lock, NULL);
+    os_posix_cond_init(&handle->cond);
+
+    pthread_mutex_lock(&os_task_list_lock);
+    handle->next = os_task_list;
+    os_task_list = handle;
+    pthread_mutex_unlock(&os_task_list_lock);
+
+    /* The handle must be visible before the thread can run and delete itself. */
+    if (p_task->p_task_handle)
+    {
+        *(p_task->p_task_handle) = (osal_task_handle_t)handle;
+    }
+
+    /* Stack size and priority are kept for reference only, host threads use the default stack and policy. */
+    pthread_attr_t attr;
+    pthread_attr_init(&attr);
+    pthread_attr_setdetachstate(&attr, PTHREAD_CREATE_DETACHED);
+    int err = pthread_create(&handle->thread, &attr, os_task_entry_wrapper, handle);
+    pthread_attr_destroy(&attr);
+
+    if (err != 0)
+    {
+        if (p_task->p_task_handle)
+        {
+            *(p_task->p_task_handle) = NULL;
+        }
+        os_task_cleanup(handle);
+        ret = OSAL_ERROR;
+    }
+    else
+    {
+        pthread_setname_np(handle->thread, handle->task_name);
+    }
+    return ret;
+}
+
+void os_task_delete_impl(osal_task_handle_t task_handle)
+{
+    osal_posix_task_handle_t *handle = (osal_posix_task_handle_t *)task_handle;
+    if (handle == NULL || handle == os_current_task)
+    {
+        /* Runs os_task_cleanup() through the handler pushed in os_task_entry_wrapper(). */
+        pthread_exit(NULL);
+    }
+
+    pthread_mutex_lock(&handle->lock);
+    bool exited = handle->exited;
+    handle->suspended = false;
+    pthread_cond_broadcast(&handle->cond);
+    if (!exited)
+    {
+        /*
+         * Deferred: the target exits at its next delay, yield or suspension point. Sent under the
+         * lock, the detached thread cannot get past its exit path and terminate meanwhile.
+         */
+        handle->deleted = true;
+        pthread_cancel(handle->thread);
+    }
+    pthread_mutex_unlock(&handle->lock);
+
+    if (exited)
+    {
+        os_task_cleanup(handle);
+    }
+}
+
+int32_t os_task_set_affinity_impl(osal_task_handle_t task_handle, osal_core_mask_t core_mask)
+{
+    osal_posix_task_handle_t *handle = (task_handle != NULL) ? (osal_posix_task_handle_t *)task_handle : os_current_task;
+    if (handle == NULL)
+    {
+        return OSAL_INVALID_POINTER;
+    }
+
+    /* The kernel thread id rather than pthread_t, a detached thread that ended leaves ESRCH behind, not a dangling handle. */
+    pthread_mutex_lock(&handle->lock);
+    handle->core_mask = core_mask;
+    if (handle->tid != 0 && !handle->exited)
+    {
+        os_task_affinity_apply(handle->tid, core_mask);
+    }
+    pthread_mutex_unlock(&handle->lock);
+    return OSAL_SUCCESS;
+}
+
+uint32_t os_task_get_core_impl(void)
+{
+    int cpu = sched_getcpu();
+    return (cpu > 0) ? (uint32_t)cpu : 0U;
+}
+
+uint32_t os_task_core_count_impl(void)
+{
+    long cpus = sysconf(_SC_NPROCESSORS_CONF);
+    if (cpus < 1)
+    {
+        return 1U;
+    }
+    return (cpus > 32) ? 32U : (uint32_t)cpus;
+}
+
+void os_task_start_impl(void)
+{
+    pthread_once(&os_epoch_once, os_epoch_init);
+
+    pthread_mutex_lock(&os_sched_mutex);
+    os_sched_started = true;
+    pthread_cond_broadcast(&os_sched_cond);
+    pthread_mutex_unlock(&os_sched_mutex);
+
+    /* Like vTaskStartScheduler(), never returns. Tasks end the process with exit(). */
+    for (;;)
+    {
+        pause();
+    }
+}
+
+void os_task_suspend_impl(osal_task_handle_t task_handle)
+{
+    osal_posix_task_handle_t *handle = (osal_posix_task_handle_t *)task_handle;
+    if (handle == NULL)
+    {
+        handle = os_current_task;
+    }
+    if (handle != NULL)
+    {
+        pthread_mutex_lock(&handle->lock);
+        handle->suspended = true;
+        pthread_mutex_unlock(&handle->lock);
+
+        if (handle == os_current_task)
+        {
+            os_posix_task_checkpoint();
+        }
+    }
+}
+
+/* Host threads run truly in parallel, the closest equivalent is the global critical lock. */
+int32_t os_sched_lock_impl(void)
+{
+    os_posix_critical_lock();
+    os_sched_lock_depth++;
+    return OSAL_SUCCESS;
+}
+
+int32_t os_sched_unlock_impl(void)
+{
+    if (os_sched_lock_depth == 0U)
+    {
+        return OSAL_ERR_INCORRECT_OBJ_STATE;
+    }
+    os_sched_lock_depth--;
+    os_posix_critical_unlock();
+    return OSAL_SUCCESS;
+}
+
+void os_task_resume_impl(osal_task_handle_t task_handle)
+{
+    osal_posix_task_handle_t *handle = (osal_posix_task_handle_t *)task_handle;
+    if (handle != NULL)
+    {
+        pthread_mutex_lock(&handle->lock);
+        handle->suspended = false;
+        pthread_cond_broadcast(&handle->cond);
+        pthread_mutex_unlock(&handle->lock);
+    }
+}
+
+static void os_task_sleep_until(const struct timespec *p_deadline)
+{
+    pthread_setcancelstate(PTHREAD_CANCEL_ENABLE, NULL);
+    while (clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, p_deadline, NULL) == EINTR)
+    {
+    }
+    pthread_setcancelstate(PTHREAD_CANCEL_DISABLE, NULL);
+
+    os_posix_task_checkpoint();
+}
+
+void os_task_delay_impl(uint32_t ticks)
+{
+    if (ticks == 0U)
+    {
+        os_port_yield_impl();
+        return;
+    }
+
+    struct timespec deadline;
+    os_posix_deadline_get(&deadline, ticks);
+    os_task_sleep_until(&deadline);
+}
+
+int32_t os_task_delay_until_impl(osal_tick_type_t *p_last_wake, osal_tick_type_t period)
+{
+    osal_tick_type_t wake = (osal_tick_type_t)(*p_last_wake + period);
+    struct timespec now;
+    struct timespec deadline;
+
+    *p_last_wake = wake;
+    pthread_once(&os_epoch_once, os_epoch_init);
+    clock_gettime(CLOCK_MONOTONIC, &now);
+
+    /* Ticks since the epoch without wrapping, the deadline is then an exact tick boundary. */
+    int64_t tick_ns = OS_POSIX_NSEC_PER_SEC / OS_POSIX_TICK_RATE_HZ;
+    int64_t elapsed = ((int64_t)(now.tv_sec - os_epoch.tv_sec) * OS_POSIX_NSEC_PER_SEC + (now.tv_nsec - os_epoch.tv_nsec)) / tick_ns;
+    if (osal_time_ticks_reached((osal_tick_type_t)elapsed, wake))
+    {
+        os_posix_task_checkpoint();
+        return OSAL_ERR_DEADLINE_MISSED;
+    }
+    deadline = os_epoch;
+    os_posix_timespec_add_ns(&deadline, (elapsed + osal_time_ticks_diff(wake, (osal_tick_type_t)elapsed)) * tick_ns);
+    os_task_sleep_until(&deadline);
+    return OSAL_SUCCESS;
+}
+
+void os_task_delay_ms_impl(uint32_t ms)
+{
+    os_task_delay_impl(OS_MS_TO_TICKS(ms));
+}
+
+uint32_t os_enter_critical_impl(void)
+{
+    os_posix_critical_lock();
+    return 0;
+}
+
+void os_exit_critical_impl(uint32_t primask)
+{
+    (void)primask;
+    os_posix_critical_unlock();
+}
+
+int32_t os_port_yield_impl(void)
+{
+    int32_t ret;
+    if (OSAL_IS_IN_ISR())
+    {
+        ret = OSAL_ERR_IN_ISR;
+    }
+    else
+    {
+        sched_yield();
+        os_posix_task_checkpoint();
+        ret = OSAL_SUCCESS;
+    }
+    return ret;
+}
+
+void os_task_disable_interrupts_impl(void)
+{
+    os_posix_critical_lock();
+    os_irq_disable_nesting++;
+}
+
+void os_task_enable_interrupts_impl(void)
+{
+    if (os_irq_disable_nesting > 0U)
+    {
+        os_irq_disable_nesting--;
+        os_posix_critical_unlock();
+    }
+}
+
+osal_tick_type_t os_task_get_tick_count_impl(void)
+{
+    struct timespec now;
+    pthread_once(&os_epoch_once, os_epoch_init);
+    clock_gettime(CLOCK_MONOTONIC, &now);
+
+    int64_t elapsed_sec = (int64_t)(now.tv_sec - os_epoch.tv_sec);
+    int64_t elapsed_nsec = (int64_t)(now.tv_nsec - os_epoch.tv_nsec);
+    osal_tick_type_t os_ticks = (osal_tick_type_t)(elapsed_sec * OS_POSIX_TICK_RATE_HZ +
+                                                   (elapsed_nsec * OS_POSIX_TICK_RATE_HZ) / OS_POSIX_NSEC_PER_SEC);
+    return os_ticks;
+}
+
+osal_task_handle_t os_task_get_current_impl(void)
+{
+    if (os_isr_nesting != 0U)
+    {
+        return NULL;
+    }
+    return (osal_task_handle_t)os_current_task;
+}
+
+osal_priority_t os_task_get_priority_impl(osal_task_handle_t task_handle)
+{
+    osal_posix_task_handle_t *handle = (task_handle != NULL) ? (osal_posix_task_handle_t *)task_handle : os_current_task;
+    return (handle != NULL) ? handle->priority : 0U;
+}
+
+/* First line of a /proc/self/task/<tid>/ file, false once the thread is gone. */
+static bool os_task_proc_read(pid_t tid, const char *file, char *buf, size_t size)
+{
+    char path[64];
+    snprintf(path, sizeof(path), "/proc/self/task/%d/%s", (int)tid, file);
+    FILE *fp = fopen(path, "r");
+    if (fp == NULL)
+    {
+        return false;
+    }
+    bool ok = (fgets(buf, (int)size, fp) != NULL);
+    fclose(fp);
+    return ok;
+}
+
+/*
+ * Host threads keep the default stack, its use is not measured. CPU time and switch counts come
+ * from the kernel's schedstat, run time in microseconds like osal_task_stats_counter().
+ */
+static void os_task_stats_fill(osal_posix_task_handle_t *handle, osal_task_stats_t *p_stats)
+{
+    char buf[256];
+
+    p_stats->handle = (osal_task_handle_t)handle;
+    memcpy(p_stats->name, handle->task_name, sizeof(p_stats->name) - 1U);
+    p_stats->priority = handle->priority;
+    p_stats->stack_free_min = OSAL_TASK_STACK_UNKNOWN;
+
+    pthread_mutex_lock(&handle->lock);
+    bool exited = handle->exited;
+    bool suspended = handle->suspended;
+    pid_t tid = handle->tid;
+    pthread_mutex_unlock(&handle->lock);
+
+    if (exited)
+    {
+        p_stats->state = OSAL_TASK_STATE_DELETED;
+        return;
+    }
+    p_stats->state = suspended ? OSAL_TASK_STATE_SUSPENDED : OSAL_TASK_STATE_READY;
+    if (tid == 0)
+    {
+        return;    // waiting for os_task_start_impl()
+    }
+
+    unsigned long long run_ns;
+    unsigned long long wait_ns;
+    unsigned long long slices;
+    if (os_task_proc_read(tid, "schedstat", buf, sizeof(buf)) &&
+        sscanf(buf, "%llu %llu %llu", &run_ns, &wait_ns, &slices) == 3)
+    {
+        p_stats->run_time = run_ns / 1000U;
+        p_stats->switch_count = (uint32_t)slices;
+    }
+    if (handle == os_current_task)
+    {
+        p_stats->state = OSAL_TASK_STATE_RUNNING;
+    }
+    else if (!suspended && os_task_proc_read(tid, "stat", buf, sizeof(buf)))
+    {
+        /* "tid (comm) S ...", comm may contain anything, the state follows the last ')'. */
+        const char *p = strrchr(buf, ')');
+        if (p != NULL && p[1] == ' ')
+        {
+            p_stats->state = (p[2] == 'R') ? OSAL_TASK_STATE_RUNNING : OSAL_TASK_STATE_BLOCKED;
+        }
+    }
+}
+
+int32_t os_task_get_stats_impl(osal_task_handle_t task_handle, osal_task_stats_t *p_stats)
+{
+    osal_posix_task_handle_t *handle = (osal_posix_task_handle_t *)task_handle;
+    if (handle == NULL)
+    {
+        return OSAL_INVALID_POINTER;
+    }
+    os_task_stats_fill(handle, p_stats);
+    return OSAL_SUCCESS;
+}
+
+/* Lists OSAL tasks only, the total is the CPU time of the whole process. */
+size_t os_task_list_stats_impl(osal_task_stats_t *p_stats, size_t max_count, uint64_t *p_total_run_time)
+{
+    size_t written = 0U;
+
+    pthread_mutex_lock(&os_task_list_lock);
+    for (osal_posix_task_handle_t *handle = os_task_list; handle != NULL && written < max_count; handle = handle->next)
+    {
+        os_task_stats_fill(handle, &p_stats[written]);
+        written++;
+    }
+    pthread_mutex_unlock(&os_task_list_lock);
+
+    if (p_total_run_time != NULL)
+    {
+        struct timespec cpu;
+        clock_gettime(CLOCK_PROCESS_CPUTIME_ID, &cpu);
+        *p_total_run_time = (uint64_t)cpu.tv_sec * 1000000U + (uint64_t)cpu.tv_nsec / 1000U;
+    }
+    return written;
+}
+
+int32_t os_task_tls_set_impl(uint32_t index, void *value)
+{
+    osal_posix_task_handle_t *handle = (osal_posix_task_handle_t *)os_task_get_current_impl();
+    if (handle == NULL || index >= OSAL_TASK_TLS_COUNT)
+    {
+        return OSAL_ERR_INCORRECT_OBJ_STATE;
+    }
+    handle->tls[index] = value;
+    return OSAL_SUCCESS;
+}
+
+void *os_task_tls_get_impl(uint32_t index)
+{
+    osal_posix_task_handle_t *handle = (osal_posix_task_handle_t *)os_task_get_current_impl();
+    if (handle == NULL || index >= OSAL_TASK_TLS_COUNT)
+    {
+        return NULL;
+    }
+    return handle->tls[index];
+}
+
+static int32_t os_task_notify(osal_posix_task_handle_t *handle, uint32_t bits, bool increment)
+{
+    pthread_mutex_lock(&handle->lock);
+    if (increment)
+    {
+        handle->notify_value++;
+    }
+    else
+    {
+        handle->notify_value |= bits;
+    }
+    handle->notify_pending = true;
+    /* cond is shared with suspend/resume. */
+    pthread_cond_broadcast(&handle->cond);
+    pthread_mutex_unlock(&handle->lock);
+    return OSAL_SUCCESS;
+}
+
+int32_t os_task_notify_give_impl(osal_task_handle_t task_handle)
+{
+    return os_task_notify((osal_posix_task_handle_t *)task_handle, 0U, true);
+}
+
+int32_t os_task_notify_set_bits_impl(osal_task_handle_t task_handle, uint32_t bits)
+{
+    return os_task_notify((osal_posix_task_handle_t *)task_handle, bits, false);
+}
+
+/* Waits on the task cond until ready holds or the timeout expires, called with handle->lock held. */
+#define OS_TASK_NOTIFY_WAIT(handle, ready, ticks)                                          \
+    do                                                                                     \
+    {                                                                                      \
+        int err = 0;                                                                       \
+        struct timespec deadline;                                                          \
+        if ((ticks) != 0U && (ticks) != OSAL_MAX_DELAY)                                    \
+        {                                                                                  \
+            os_posix_deadline_get(&deadline, (ticks));                                     \
+        }                                                                                  \
+        while (!(ready) && (ticks) != 0U && err == 0)                                      \
+        {                                                                                  \
+            err = os_posix_cond_wait(&(handle)->cond, &(handle)->lock,                     \
+                                     ((ticks) == OSAL_MAX_DELAY) ? NULL : &deadline);      \
+        }                                                                                  \
+    } while (0)
+
+int32_t os_task_notify_take_impl(bool clear_on_exit, uint32_t *p_count, osal_tick_type_t timeout)
+{
+    int32_t ret;
+    osal_posix_task_handle_t *handle = os_current_task;
+    osal_tick_type_t ticks = OS_MS_TO_TICKS(timeout);
+
+    if (OSAL_IS_IN_ISR())
+    {
+        return OSAL_ERR_IN_ISR;
+    }
+    if (handle == NULL)
+    {
+        return OSAL_ERROR;
+    }
+
+    pthread_mutex_lock(&handle->lock);
+    OS_TASK_NOTIFY_WAIT(handle, handle->notify_value != 0U, ticks);
+    if (handle->notify_value != 0U)
+    {
+        if (p_count != NULL)
+        {
+            *p_count = handle->notify_value;
+        }
+        handle->notify_value = clear_on_exit ? 0U : (handle->notify_value - 1U);
+        handle->notify_pending = false;
+        ret = OSAL_SUCCESS;
+    }
+    else
+    {
+        ret = OSAL_ERROR_TIMEOUT;
+    }
+    pthread_mutex_unlock(&handle->lock);
+    return ret;
+}
+
+int32_t os_task_notify_wait_impl(uint32_t clear_on_entry, uint32_t clear_on_exit, uint32_t *p_value, osal_tick_type_t timeout)
+{
+    int32_t ret;
+    osal_posix_task_handle_t *handle = os_current_task;
+    osal_tick_type_t ticks = OS_MS_TO_TICKS(timeout);
+
+    if (OSAL_IS_IN_ISR())
+    {
+        return OSAL_ERR_IN_ISR;
+    }
+    if (handle == NULL)
+    {
+        return OSAL_ERROR;
+    }
+
+    pthread_mutex_lock(&handle->lock);
+    if (!handle->notify_pending)
+    {
+        handle->notify_value &= ~clear_on_entry;
+    }
+    OS_TASK_NOTIFY_WAIT(handle, handle->notify_pending, ticks);
+    if (handle->notify_pending)
+    {
+        if (p_value != NULL)
+        {
+            *p_value = handle->notify_value;
+        }
+        handle->notify_value &= ~clear_on_exit;
+        handle->notify_pending = false;
+        ret = OSAL_SUCCESS;
+    }
+    else
+    {
+        ret = OSAL_ERROR_TIMEOUT;
+    }
+    pthread_mutex_unlock(&handle->lock);
+    return ret;
+}
+
+#endif // OSAL_RTOS_SUPPORT
@@ -0,0 +1,22 @@
+#include "osal_internal_time.h"
+#include "os_posix.h"
+
+#if (OSAL_RTOS_SUPPORT == POSIX_SUPPORT)
+
+osal_time_us_t os_time_now_us_impl(void)
+{
+    struct timespec epoch;
+    struct timespec now;
+
+    os_posix_epoch_get(&epoch);
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    int64_t elapsed_ns = (int64_t)(now.tv_sec - epoch.tv_sec) * OS_POSIX_NSEC_PER_SEC + (now.tv_nsec - epoch.tv_nsec);
+    return (osal_time_us_t)(elapsed_ns / 1000);
+}
+
+uint32_t os_time_tick_rate_hz_impl(void)
+{
+    return OS_POSIX_TICK_RATE_HZ;
+}
+
+#endif // OSAL_RTOS_SUPPORT
@@ -0,0 +1,255 @@
+#include "osal_internal_timer.h"
+#include "osal_internal_globaldefs.h"
+#include "os_posix.h"
+#include "osal_internal_heap.h"
+
+#if (OSAL_RTOS_SUPPORT == POSIX_SUPPORT)
+
+/*
+ * Software timers are serviced by one daemon thread, like the FreeRTOS timer task.
+ * Active timers sit in a list sorted by expiry and the daemon sleeps on a monotonic
+ * condition variable until the earliest one is due. Callbacks run in the daemon thread.
+ */
+typedef struct os_posix_timer
+{
+    struct os_posix_timer *next;
+    osal_timer_internal_record_t *timer_record;
+    struct timespec expiry;
+    osal_tick_type_t timer_period;  // unit:ticks
+    uint8_t auto_reload;
+    bool active;
+    bool delete_pending;
+    bool cb_allocated;
+} os_posix_timer_t;
+
+OSAL_STATIC_ASSERT(OSAL_TIMER_STATIC_CB_SIZE >= sizeof(os_posix_timer_t), timer_static_size);
+
+static pthread_mutex_t os_timer_lock = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t os_timer_cond;
+static pthread_once_t os_timer_once = PTHREAD_ONCE_INIT;
+static pthread_t os_timer_thread;
+static os_posix_timer_t *os_timer_active_list = NULL;
+static os_posix_timer_t *os_timer_running = NULL;
+
+static bool os_timespec_before(const struct timespec *a, const struct timespec *b)
+{
+    return (a->tv_sec < b->tv_sec) || (a->tv_sec == b->tv_sec && a->tv_nsec < b->tv_nsec);
+}
+
+/* List helpers, called with os_timer_lock held. */
+static void os_timer_unlink(os_posix_timer_t *timer)
+{
+    os_posix_timer_t **pp = &os_timer_active_list;
+    while (*pp != NULL)
+    {
+        if (*pp == timer)
+        {
+            *pp = timer->next;
+            break;
+        }
+        pp = &(*pp)->next;
+    }
+    timer->next = NULL;
+    timer->active = false;
+}
+
+static void os_timer_insert(os_posix_timer_t *timer)
+{
+    os_posix_timer_t **pp = &os_timer_active_list;
+    while (*pp != NULL && !os_timespec_before(&timer->expiry, &(*pp)->expiry))
+    {
+        pp = &(*pp)->next;
+    }
+    timer->next = *pp;
+    *pp = timer;
+    timer->active = true;
+}
+
+static void os_timer_arm(os_posix_timer_t *timer)
+{
+    if (timer->active)
+    {
+        os_timer_unlink(timer);
+    }
+    os_posix_deadline_get(&timer->expiry, timer->timer_period);
+    os_timer_insert(timer);
+    pthread_cond_broadcast(&os_timer_cond);
+}
+
+/* Dynamic timers own both the osal record and the timer, static ones live in the caller's buffer. */
+static void os_timer_free(os_posix_timer_t *timer)
+{
+    if (timer->cb_allocated)
+    {
+        os_heap_free_impl(timer->timer_record);
+        os_heap_free_impl(timer);
+    }
+}
+
+static void *os_timer_daemon(void *arg)
+{
+    (void)arg;
+    pthread_mutex_lock(&os_timer_lock);
+    for (;;)
+    {
+        os_posix_timer_t *timer = os_timer_active_list;
+        if (timer == NULL)
+        {
+            os_posix_cond_wait(&os_timer_cond, &os_timer_lock, NULL);
+            continue;
+        }
+
+        struct timespec now;
+        clock_gettime(CLOCK_MONOTONIC, &now);
+        if (os_timespec_before(&now, &timer->expiry))
+        {
+            os_posix_cond_wait(&os_timer_cond, &os_timer_lock, &timer->expiry);
+            continue;
+        }
+
+        os_timer_unlink(timer);
+        if (timer->auto_reload)
+        {
+            /* Reload from the previous expiry so periodic timers do not drift. */
+            os_posix_timespec_add_ns(&timer->expiry, os_posix_ticks_to_ns(timer->timer_period));
+            os_timer_insert(timer);
+        }
+
+        os_timer_running = timer;
+        pthread_mutex_unlock(&os_timer_lock);
+        osal_timer_internal_record_t *timer_record = timer->timer_record;
+        if (timer_record != NULL && timer_record->timer_id.func != NULL)
+        {
+            timer_record->timer_id.func(timer_record->timer_id.timer_handle, timer_record->timer_id.arg);
+        }
+        pthread_mutex_lock(&os_timer_lock);
+        os_timer_running = NULL;
+        pthread_cond_broadcast(&os_timer_cond);
+
+        if (timer->delete_pending)
+        {
+            os_timer_free(timer);
+        }
+    }
+    return NULL;
+}
+
+static void os_timer_daemon_start(void)
+{
+    os_posix_cond_init(&os_timer_cond);
+    pthread_create(&os_timer_thread, NULL, os_timer_daemon, NULL);
+    pthread_detach(os_timer_thread);
+}
+
+int32_t os_timer_create_impl(osal_timer_handle_t *p_timer_handle, osal_timer_internal_record_t *timer_record)
+{
+    int32_t ret = OSAL_SUCCESS;
+
+    pthread_once(&os_timer_once, os_timer_daemon_start);
+
+    os_posix_timer_t *timer = (os_posix_timer_t *)timer_record->cb_memory;
+    if (timer == NULL)
+    {
+        timer = (os_posix_timer_t *)os_heap_malloc_impl(sizeof(os_posix_timer_t));
+    }
+    if (timer == NULL)
+    {
+        *p_timer_handle = NULL;
+        return OSAL_INVALID_POINTER;
+    }
+    memset(timer, 0, sizeof(os_posix_timer_t));
+    timer->cb_allocated = (timer_record->cb_memory == NULL);
+    timer->timer_record = timer_record;
+    timer->timer_period = OS_MS_TO_TICKS(timer_record->timer_period);
+    timer->auto_reload = timer_record->auto_reload;
+
+    *p_timer_handle = (osal_timer_handle_t)timer;
+    timer_record->timer_id.timer_handle = *p_timer_handle;
+    return ret;
+}
+
+int32_t os_timer_start_impl(osal_timer_handle_t timer_handle, osal_tick_type_t ticks_to_wait)
+{
+    os_posix_timer_t *timer = (os_posix_timer_t *)timer_handle;
+    (void)ticks_to_wait;
+    OSAL_CHECK_POINTER(timer);
+
+    pthread_mutex_lock(&os_timer_lock);
+    os_timer_arm(timer);
+    pthread_mutex_unlock(&os_timer_lock);
+    return OSAL_SUCCESS;
+}
+
+int32_t os_timer_stop_impl(osal_timer_handle_t timer_handle, osal_tick_type_t ticks_to_wait)
+{
+    os_posix_timer_t *timer = (os_posix_timer_t *)timer_handle;
+    (void)ticks_to_wait;
+    OSAL_CHECK_POINTER(timer);
+
+    pthread_mutex_lock(&os_timer_lock);
+    if (timer->active)
+    {
+        os_timer_unlink(timer);
+    }
+    pthread_mutex_unlock(&os_timer_lock);
+    return OSAL_SUCCESS;
+}
+
+int32_t os_timer_period_change_impl(osal_timer_handle_t timer_handle, osal_tick_type_t new_period, osal_tick_type_t ticks_to_wait)
+{
+    os_posix_timer_t *timer = (os_posix_timer_t *)timer_handle;
+    (void)ticks_to_wait;
+    OSAL_CHECK_POINTER(timer);
+
+    /* Same as xTimerChangePeriod(): the new period applies from now and a dormant timer is started. */
+    pthread_mutex_lock(&os_timer_lock);
+    timer->timer_period = OS_MS_TO_TICKS(new_period);
+    os_timer_arm(timer);
+    pthread_mutex_unlock(&os_timer_lock);
+    return OSAL_SUCCESS;
+}
+
+int32_t os_timer_delete_impl(osal_timer_handle_t timer_handle, osal_tick_type_t ticks_to_wait)
+{
+    os_posix_timer_t *timer = (os_posix_timer_t *)timer_handle;
+    (void)ticks_to_wait;
+    OSAL_CHECK_POINTER(timer);
+
+    pthread_mutex_lock(&os_timer_lock);
+    if (timer->active)
+    {
+        os_timer_unlink(timer);
+    }
+    if (os_timer_running == timer && pthread_equal(pthread_self(), os_timer_thread))
+    {
+        /* Deleted from its own callback, the daemon frees it once the callback returns. */
+        timer->delete_pending = true;
+    }
+    else
+    {
+        while (os_timer_running == timer)
+        {
+            os_posix_cond_wait(&os_timer_cond, &os_timer_lock, NULL);
+        }
+        os_timer_free(timer);
+    }
+    pthread_mutex_unlock(&os_timer_lock);
+    return OSAL_SUCCESS;
+}
+
+int32_t os_timer_reset_impl(osal_timer_handle_t timer_handle, osal_tick_type_t ticks_to_wait)
+{
+    return os_timer_start_impl(timer_handle, ticks_to_wait);
+}
+
+osal_tick_type_t os_timer_period_get_impl(osal_timer_handle_t timer_handle)
+{
+    os_posix_timer_t *timer = (os_posix_timer_t *)timer_handle;
+    if (timer == NULL)
+    {
+        return 0;
+    }
+    return osal_time_ticks_to_ms_at(timer->timer_period, OS_POSIX_TICK_RATE_HZ);
+}
+
+#endif // OSAL_RTOS_SUPPORT
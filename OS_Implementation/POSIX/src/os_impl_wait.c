@@ -0,0 +1,196 @@
+#include "osal_internal_wait.h"
+#include "os_posix.h"
+#include "osal_internal_heap.h"
+
+#if (OSAL_RTOS_SUPPORT == POSIX_SUPPORT)
+
+/*
+ * Wait set
+ * Members post their handle into the set's event ring on every send/give, the ring is
+ * protected by the set lock which nests inside the member's own lock.
+ */
+typedef struct
+{
+    void *member;
+    bool is_queue;
+} os_posix_wait_member_t;
+
+typedef struct
+{
+    pthread_mutex_t lock;
+    pthread_cond_t ready;
+    os_posix_wait_member_t members[OS_POSIX_WAIT_SET_MAX_MEMBERS];
+    size_t max_events;
+    size_t head;
+    size_t count;
+    void **events;
+} os_posix_wait_set_t;
+
+void os_posix_wait_set_post(void *set, void *member, size_t count)
+{
+    os_posix_wait_set_t *handle = (os_posix_wait_set_t *)set;
+
+    pthread_mutex_lock(&handle->lock);
+    /* Like a FreeRTOS queue set, max_events sized for every member never overflows. */
+    while (count != 0U && handle->count < handle->max_events)
+    {
+        handle->events[(handle->head + handle->count) % handle->max_events] = member;
+        handle->count++;
+        count--;
+    }
+    pthread_cond_signal(&handle->ready);
+    pthread_mutex_unlock(&handle->lock);
+}
+
+int32_t os_wait_set_create_impl(size_t max_events, osal_wait_set_handle_t *p_set_handle)
+{
+    int32_t ret;
+    os_posix_wait_set_t *cur_set_handle;
+
+    cur_set_handle = (os_posix_wait_set_t *)os_heap_malloc_impl(sizeof(os_posix_wait_set_t) + max_events * sizeof(void *));
+    if (cur_set_handle == NULL)
+    {
+        ret = OSAL_ERROR;
+    }
+    else
+    {
+        memset(cur_set_handle, 0, sizeof(os_posix_wait_set_t));
+        pthread_mutex_init(&cur_set_handle->lock, NULL);
+        os_posix_cond_init(&cur_set_handle->ready);
+        cur_set_handle->max_events = max_events;
+        cur_set_handle->events = (void **)(cur_set_handle + 1);
+        *p_set_handle = (osal_wait_set_handle_t)cur_set_handle;
+        ret = OSAL_SUCCESS;
+    }
+    return ret;
+}
+
+static int32_t os_wait_set_unbind(os_posix_wait_member_t *p_member, void *set)
+{
+    int32_t ret;
+    if (p_member->is_queue)
+    {
+        ret = os_posix_queue_wait_set_bind(p_member->member, NULL, set);
+    }
+    else
+    {
+        ret = os_posix_sema_wait_set_bind(p_member->member, NULL, set);
+    }
+    p_member->member = NULL;
+    return ret;
+}
+
+int32_t os_wait_set_delete_impl(osal_wait_set_handle_t set_handle)
+{
+    os_posix_wait_set_t *handle = (os_posix_wait_set_t *)set_handle;
+
+    for (size_t i = 0; i < OS_POSIX_WAIT_SET_MAX_MEMBERS; i++)
+    {
+        if (handle->members[i].member != NULL)
+        {
+            (void)os_wait_set_unbind(&handle->members[i], handle);
+        }
+    }
+    pthread_mutex_destroy(&handle->lock);
+    pthread_cond_destroy(&handle->ready);
+    os_heap_free_impl(handle);
+    return OSAL_SUCCESS;
+}
+
+static int32_t os_wait_set_add(os_posix_wait_set_t *handle, void *member, bool is_queue)
+{
+    int32_t ret;
+    os_posix_wait_member_t *free_slot = NULL;
+
+    /* Member table changes are serialized by the caller like other create/delete calls. */
+    for (size_t i = 0; i < OS_POSIX_WAIT_SET_MAX_MEMBERS; i++)
+    {
+        if (handle->members[i].member == NULL)
+        {
+            free_slot = &handle->members[i];
+            break;
+        }
+    }
+    if (free_slot == NULL)
+    {
+        return OSAL_ERR_NO_FREE_IDS;
+    }
+
+    if (is_queue)
+    {
+        ret = os_posix_queue_wait_set_bind(member, handle, NULL);
+    }
+    else
+    {
+        ret = os_posix_sema_wait_set_bind(member, handle, NULL);
+    }
+    if (ret == OSAL_SUCCESS)
+    {
+        free_slot->member = member;
+        free_slot->is_queue = is_queue;
+    }
+    return ret;
+}
+
+int32_t os_wait_set_add_queue_impl(osal_wait_set_handle_t set_handle, osal_queue_handle_t queue_handle)
+{
+    return os_wait_set_add((os_posix_wait_set_t *)set_handle, queue_handle, true);
+}
+
+int32_t os_wait_set_add_sema_impl(osal_wait_set_handle_t set_handle, osal_sema_handle_t sema_handle)
+{
+    return os_wait_set_add((os_posix_wait_set_t *)set_handle, sema_handle, false);
+}
+
+int32_t os_wait_set_remove_impl(osal_wait_set_handle_t set_handle, void *member_handle)
+{
+    os_posix_wait_set_t *handle = (os_posix_wait_set_t *)set_handle;
+
+    for (size_t i = 0; i < OS_POSIX_WAIT_SET_MAX_MEMBERS; i++)
+    {
+        if (handle->members[i].member == member_handle)
+        {
+            return os_wait_set_unbind(&handle->members[i], handle);
+        }
+    }
+    return OSAL_ERR_INCORRECT_OBJ_STATE;
+}
+
+int32_t os_wait_any_impl(osal_wait_set_handle_t set_handle, void **p_ready_handle, osal_tick_type_t timeout)
+{
+    int32_t ret;
+    int err = 0;
+    struct timespec deadline;
+    os_posix_wait_set_t *handle = (os_posix_wait_set_t *)set_handle;
+    osal_tick_type_t ticks = OS_MS_TO_TICKS(timeout);
+
+    if (OSAL_IS_IN_ISR())
+    {
+        ticks = 0U;
+    }
+    if (ticks != 0U && ticks != OSAL_MAX_DELAY)
+    {
+        os_posix_deadline_get(&deadline, ticks);
+    }
+
+    pthread_mutex_lock(&handle->lock);
+    while (handle->count == 0U && ticks != 0U && err == 0)
+    {
+        err = os_posix_cond_wait(&handle->ready, &handle->lock, (ticks == OSAL_MAX_DELAY) ? NULL : &deadline);
+    }
+    if (handle->count != 0U)
+    {
+        *p_ready_handle = handle->events[handle->head];
+        handle->head = (handle->head + 1U) % handle->max_events;
+        handle->count--;
+        ret = OSAL_SUCCESS;
+    }
+    else
+    {
+        ret = OSAL_ERROR_TIMEOUT;
+    }
+    pthread_mutex_unlock(&handle->lock);
+    return ret;
+}
+
+#endif // OSAL_RTOS_SUPPORT
@@ -3,10 +3,41 @@
 
 #include <string.h>
 #include "tx_api.h"
+#include "osal_internal_time.h"
 
 #define OS_MS_TO_TICKS(osal_time_in_ms) \
-    ((osal_time_in_ms == OSAL_MAX_DELAY)? (TX_WAIT_FOREVER): ((osal_tick_type_t)(((osal_tick_type_t)(osal_time_in_ms) * (osal_tick_type_t)TX_TIMER_TICKS_PER_SECOND) / (osal_tick_type_t)1000U)))
+    (((osal_time_in_ms) == OSAL_MAX_DELAY)? (TX_WAIT_FOREVER): ((ULONG)osal_time_ms_to_ticks_at((osal_time_in_ms), TX_TIMER_TICKS_PER_SECOND)))
 
-#define OSAL_HEAP_POOL_SIZE         20480     
+/*
+ * Exclusion for the OSAL's own bookkeeping. tx_interrupt_control() only masks the calling core,
+ * SMP builds take the kernel's inter-core protection instead, which masks interrupts too and
+ * nests on one core.
+ */
+#ifdef TX_THREAD_SMP_MAX_CORES
+UINT _tx_thread_smp_protect(VOID);
+VOID _tx_thread_smp_unprotect(UINT interrupt_save);
+#define OS_THREADX_PROTECT()            _tx_thread_smp_protect()
+#define OS_THREADX_UNPROTECT(posture)   _tx_thread_smp_unprotect(posture)
+#else
+#define OS_THREADX_PROTECT()            tx_interrupt_control(TX_INT_DISABLE)
+#define OS_THREADX_UNPROTECT(posture)   ((void)tx_interrupt_control(posture))
+#endif
+
+/* Queues and semaphores that can be attached to an osal wait set at the same time. */
+#define OSAL_WAIT_SET_MAX_MEMBERS   16
+
+/*
+ * Semaphore wrapper structure
+ * Both binary and counting semaphores use TX_SEMAPHORE
+ * Binary semaphore: max_count = 1, initial_count = 0
+ * Counting semaphore: max_count = user specified, initial_count = user specified
+ * semaphore must stay the first member, wait set notifications map TX_SEMAPHORE * back to the handle.
+ */
+typedef struct 
+{
+    TX_SEMAPHORE semaphore;
+    uint32_t max_count;  // Max count: 1 for binary, custom for counting
+    uint8_t allocated;   // from the OSAL heap, 0 for osal_sema_create_static()
+} os_sema_wrapper_t;
 
 #endif // __OS_THREADX_H__
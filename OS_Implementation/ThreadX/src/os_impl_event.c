@@ -0,0 +1,100 @@
+#include "osal_internal_event.h"
+#include "os_threadx.h"
+#include "osal_internal_heap.h"
+//#include "app_log.h"
+
+#if (OSAL_RTOS_SUPPORT == THREADX_SUPPORT)
+
+int32_t os_event_create_impl(osal_event_handle_t *p_event_handle)
+{
+    int32_t ret;
+    TX_EVENT_FLAGS_GROUP *cur_event_handle;
+
+    cur_event_handle = (TX_EVENT_FLAGS_GROUP *)os_heap_malloc_impl(sizeof(TX_EVENT_FLAGS_GROUP));
+    if (cur_event_handle == NULL)
+    {
+        ret = OSAL_ERROR;
+    }
+    else if (tx_event_flags_create(cur_event_handle, "event") != TX_SUCCESS)
+    {
+        os_heap_free_impl(cur_event_handle);
+        ret = OSAL_ERROR;
+    }
+    else
+    {
+        *p_event_handle = (osal_event_handle_t)cur_event_handle;
+        ret = OSAL_SUCCESS;
+    }
+    return ret;
+}
+
+int32_t os_event_delete_impl(osal_event_handle_t event_handle)
+{
+    TX_EVENT_FLAGS_GROUP *handle = (TX_EVENT_FLAGS_GROUP *)event_handle;
+    tx_event_flags_delete(handle);
+    os_heap_free_impl(handle);
+    return OSAL_SUCCESS;
+}
+
+int32_t os_event_set_impl(osal_event_handle_t event_handle, osal_event_bits_t bits)
+{
+    UINT status = tx_event_flags_set((TX_EVENT_FLAGS_GROUP *)event_handle, (ULONG)bits, TX_OR);
+    return (status == TX_SUCCESS) ? OSAL_SUCCESS : OSAL_ERROR;
+}
+
+int32_t os_event_clear_impl(osal_event_handle_t event_handle, osal_event_bits_t bits)
+{
+    UINT status = tx_event_flags_set((TX_EVENT_FLAGS_GROUP *)event_handle, ~(ULONG)bits, TX_AND);
+    return (status == TX_SUCCESS) ? OSAL_SUCCESS : OSAL_ERROR;
+}
+
+int32_t os_event_wait_impl(osal_event_handle_t event_handle, osal_event_bits_t bits, uint32_t options,
+                           osal_event_bits_t *p_bits, osal_tick_type_t timeout)
+{
+    int32_t ret;
+    UINT status;
+    UINT get_option;
+    ULONG actual_flags = 0;
+    TX_EVENT_FLAGS_GROUP *handle = (TX_EVENT_FLAGS_GROUP *)event_handle;
+
+    if (OSAL_IS_IN_ISR())
+    {
+        return OSAL_ERR_IN_ISR;
+    }
+
+    if ((options & OSAL_EVENT_WAIT_ALL) != 0U)
+    {
+        get_option = ((options & OSAL_EVENT_CLEAR_ON_EXIT) != 0U) ? TX_AND_CLEAR : TX_AND;
+    }
+    else
+    {
+        get_option = ((options & OSAL_EVENT_CLEAR_ON_EXIT) != 0U) ? TX_OR_CLEAR : TX_OR;
+    }
+
+    status = tx_event_flags_get(handle, (ULONG)bits, get_option, &actual_flags, OS_MS_TO_TICKS(timeout));
+    if (status == TX_SUCCESS)
+    {
+        ret = OSAL_SUCCESS;
+    }
+    else
+    {
+        /* actual_flags is only written on success, report the current value like FreeRTOS does. */
+        actual_flags = (ULONG)os_event_get_impl(event_handle);
+        ret = OSAL_ERROR_TIMEOUT;
+    }
+
+    if (p_bits != NULL)
+    {
+        *p_bits = (osal_event_bits_t)(actual_flags & OSAL_EVENT_BITS_MASK);
+    }
+    return ret;
+}
+
+osal_event_bits_t os_event_get_impl(osal_event_handle_t event_handle)
+{
+    ULONG current_flags = 0;
+    (void)tx_event_flags_info_get((TX_EVENT_FLAGS_GROUP *)event_handle, NULL, &current_flags, NULL, NULL, NULL);
+    return (osal_event_bits_t)(current_flags & OSAL_EVENT_BITS_MASK);
+}
+
+#endif // OSAL_RTOS_SUPPORT
@@ -1,40 +1,187 @@
+#define OSAL_HEAP_IMPL_SOURCE
 #include "osal_internal_heap.h"
+#include "osal_internal_tlsf.h"
 #include "os_threadx.h"
 
 #if (OSAL_RTOS_SUPPORT == THREADX_SUPPORT)
 
+#if (OSAL_HEAP_USE_TLSF == 1)
+
+void os_heap_init_impl(void)
+{
+    osal_tlsf_heap_init();
+}
+
+void *os_heap_malloc_impl(size_t wanted_size)
+{
+    return osal_tlsf_heap_malloc(wanted_size);
+}
+
+void *os_heap_malloc_aligned_impl(size_t wanted_size, size_t align)
+{
+    return osal_tlsf_heap_memalign(wanted_size, align);
+}
+
+void os_heap_free_impl(void *ptr)
+{
+    osal_tlsf_heap_free(ptr);
+}
+
+void os_heap_get_stats_impl(osal_heap_stats_t *p_stats)
+{
+    osal_tlsf_heap_get_stats(p_stats);
+}
+
+size_t os_heap_get_free_impl(void)
+{
+    return osal_tlsf_heap_get_free();
+}
+
+#else
+
 // ThreadX byte pool for dynamic memory allocation
 static TX_BYTE_POOL os_byte_pool;
 
 static uint8_t os_byte_pool_memory[OSAL_HEAP_POOL_SIZE]; 
-static bool os_heap_initialized = false;
+static volatile bool os_heap_initialized = false;
+
+/* Kept here rather than from tx_byte_pool_performance_info_get(), which needs TX_BYTE_POOL_ENABLE_PERFORMANCE_INFO. */
+static uint32_t os_heap_alloc_count = 0;
+static uint32_t os_heap_free_count = 0;
+static uint32_t os_heap_failed_count = 0;
+static ULONG os_heap_min_available = 0;
+
+/* Owner word of a free block, tx_byte_pool.h is not part of the public ThreadX headers. */
+#ifndef TX_BYTE_BLOCK_FREE
+#define TX_BYTE_BLOCK_FREE  ((ULONG)0xFFFFEEEEUL)
+#endif
 
-static void os_heap_init(void)
+/*
+ * Normally run once by osal_heap_init() before the scheduler starts. The first allocation
+ * still falls back to it, the flag is tested again with interrupts disabled so two threads
+ * racing there cannot create the pool twice.
+ */
+void os_heap_init_impl(void)
 {
-    tx_byte_pool_create(&os_byte_pool, "os_byte_pool", os_byte_pool_memory, OSAL_HEAP_POOL_SIZE);
+    UINT posture = OS_THREADX_PROTECT();
+    if (!os_heap_initialized)
+    {
+        tx_byte_pool_create(&os_byte_pool, "os_byte_pool", os_byte_pool_memory, OSAL_HEAP_POOL_SIZE);
+        os_heap_min_available = os_byte_pool.tx_byte_pool_available;
+        os_heap_initialized = true;
+    }
+    OS_THREADX_UNPROTECT(posture);
 }
 
 void *os_heap_malloc_impl(size_t wanted_size)
 {
     void *ptr;
+    UINT status;
+    UINT posture;
     if (!os_heap_initialized)
     {
-        os_heap_init();
-        os_heap_initialized = true;
+        os_heap_init_impl();
+    }
+    status = tx_byte_allocate(&os_byte_pool, &ptr, wanted_size, TX_NO_WAIT);
+
+    posture = OS_THREADX_PROTECT();
+    if (status == TX_SUCCESS)
+    {
+        os_heap_alloc_count++;
+        if (os_byte_pool.tx_byte_pool_available < os_heap_min_available)
+        {
+            os_heap_min_available = os_byte_pool.tx_byte_pool_available;
+        }
+    }
+    else
+    {
+        os_heap_failed_count++;
+        ptr = NULL;
     }
-    if (tx_byte_allocate(&os_byte_pool, &ptr, wanted_size, TX_NO_WAIT) == TX_SUCCESS)
+    OS_THREADX_UNPROTECT(posture);
+    if (ptr == NULL)
     {
-        return ptr;
+        osal_heap_report_failure(wanted_size);
     }
-    return NULL;
+    return ptr;
+}
+
+void *os_heap_malloc_aligned_impl(size_t wanted_size, size_t align)
+{
+    void *raw;
+    if (align <= sizeof(ALIGN_TYPE))
+    {
+        return os_heap_malloc_impl(wanted_size);
+    }
+    raw = os_heap_malloc_impl(wanted_size + OSAL_HEAP_ALIGN_OVERHEAD(align));
+    return (raw != NULL) ? osal_heap_align_block(raw, align) : NULL;
 }
 
 void os_heap_free_impl(void *ptr)
 {
     if (ptr != NULL)
     {
-        tx_byte_release(ptr);
+        uint8_t *raw = (uint8_t *)osal_heap_align_raw(ptr);
+        if (raw >= os_byte_pool_memory && raw < &os_byte_pool_memory[OSAL_HEAP_POOL_SIZE])
+        {
+            ptr = raw;
+        }
+        if (tx_byte_release(ptr) == TX_SUCCESS)
+        {
+            UINT posture = OS_THREADX_PROTECT();
+            os_heap_free_count++;
+            OS_THREADX_UNPROTECT(posture);
+        }
+    }
+}
+
+/*
+ * Walks every fragment of the pool with interrupts disabled to find the free ones,
+ * meant for diagnostics rather than periodic polling.
+ */
+void os_heap_get_stats_impl(osal_heap_stats_t *p_stats)
+{
+    ULONG available;
+    ULONG fragments;
+    UCHAR *block;
+    UINT posture;
+
+    if (!os_heap_initialized)
+    {
+        os_heap_init_impl();
     }
+    (void)tx_byte_pool_info_get(&os_byte_pool, TX_NULL, &available, &fragments, TX_NULL, TX_NULL, TX_NULL);
+    p_stats->total_size = os_byte_pool.tx_byte_pool_size;
+    p_stats->free_size = available;
+
+    posture = OS_THREADX_PROTECT();
+    block = os_byte_pool.tx_byte_pool_list;
+    while (fragments-- > 0U)
+    {
+        UCHAR *next = *((UCHAR **)block);
+        if (*((ALIGN_TYPE *)(block + sizeof(UCHAR *))) == TX_BYTE_BLOCK_FREE)
+        {
+            size_t size = (size_t)(next - block) - (sizeof(UCHAR *) + sizeof(ALIGN_TYPE));
+            p_stats->free_blocks++;
+            if (size > p_stats->largest_free_block)
+            {
+                p_stats->largest_free_block = size;
+            }
+        }
+        block = next;
+    }
+    p_stats->min_ever_free_size = os_heap_min_available;
+    p_stats->alloc_count = os_heap_alloc_count;
+    p_stats->free_count = os_heap_free_count;
+    p_stats->failed_count = os_heap_failed_count;
+    OS_THREADX_UNPROTECT(posture);
+}
+
+size_t os_heap_get_free_impl(void)
+{
+    return os_heap_initialized ? (size_t)os_byte_pool.tx_byte_pool_available : (size_t)OSAL_HEAP_POOL_SIZE;
 }
 
+#endif // OSAL_HEAP_USE_TLSF
+
 #endif // OSAL_RTOS_SUPPORT
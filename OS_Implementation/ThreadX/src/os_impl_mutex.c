@@ -4,19 +4,28 @@
 
 #if (OSAL_RTOS_SUPPORT == THREADX_SUPPORT)
 
+/* mutex stays the first member, give/take use the handle as a TX_MUTEX *. */
+typedef struct
+{
+    TX_MUTEX mutex;
+    uint8_t allocated;   // from the OSAL heap, 0 for osal_mutex_create_static()
+} os_mutex_wrapper_t;
+
+OSAL_STATIC_ASSERT(sizeof(osal_mutex_static_t) >= sizeof(os_mutex_wrapper_t), mutex_static_size);
+
 int32_t os_mutex_create_impl(osal_mutex_handle_t *p_mutex_handle)
 {
     int32_t ret;
-    TX_MUTEX *cur_mutex_handle;
+    os_mutex_wrapper_t *cur_mutex_handle;
     
-    cur_mutex_handle = (TX_MUTEX *)os_heap_malloc_impl(sizeof(TX_MUTEX));
+    cur_mutex_handle = (os_mutex_wrapper_t *)os_heap_malloc_impl(sizeof(os_mutex_wrapper_t));
     if (cur_mutex_handle == NULL)
     {
         ret = OSAL_ERROR;
     }
     else
     {
-        UINT status = tx_mutex_create(cur_mutex_handle, "mutex", TX_NO_INHERIT);
+        UINT status = tx_mutex_create(&cur_mutex_handle->mutex, "mutex", TX_NO_INHERIT);
         if (status != TX_SUCCESS)
         {
             os_heap_free_impl(cur_mutex_handle);
@@ -24,6 +33,7 @@ int32_t os_mutex_create_impl(osal_mutex_handle_t *p_mutex_handle)
         }
         else
         {
+            cur_mutex_handle->allocated = 1U;
             *p_mutex_handle = (osal_mutex_handle_t)cur_mutex_handle;
             ret = OSAL_SUCCESS;
         }
@@ -31,13 +41,35 @@ int32_t os_mutex_create_impl(osal_mutex_handle_t *p_mutex_handle)
     return ret;
 }
 
+int32_t os_mutex_create_static_impl(osal_mutex_handle_t *p_mutex_handle, void *cb_memory)
+{
+    int32_t ret;
+    os_mutex_wrapper_t *cur_mutex_handle = (os_mutex_wrapper_t *)cb_memory;
+
+    memset(cur_mutex_handle, 0, sizeof(os_mutex_wrapper_t));
+    UINT status = tx_mutex_create(&cur_mutex_handle->mutex, "mutex", TX_NO_INHERIT);
+    if (status != TX_SUCCESS)
+    {
+        ret = OSAL_ERROR;
+    }
+    else
+    {
+        *p_mutex_handle = (osal_mutex_handle_t)cur_mutex_handle;
+        ret = OSAL_SUCCESS;
+    }
+    return ret;
+}
+
 void os_mutex_delete_impl(osal_mutex_handle_t mutex_handle)
 {
-    TX_MUTEX *handle = (TX_MUTEX *)mutex_handle;
+    os_mutex_wrapper_t *handle = (os_mutex_wrapper_t *)mutex_handle;
     if (handle != NULL)
     {
-        tx_mutex_delete(handle);
-        os_heap_free_impl(handle);
+        tx_mutex_delete(&handle->mutex);
+        if (handle->allocated != 0U)
+        {
+            os_heap_free_impl(handle);
+        }
     }
 }
 
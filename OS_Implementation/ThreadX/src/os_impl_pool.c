@@ -0,0 +1,130 @@
+#include "osal_internal_pool.h"
+#include "os_threadx.h"
+#include "osal_internal_heap.h"
+//#include "app_log.h"
+
+#if (OSAL_RTOS_SUPPORT == THREADX_SUPPORT)
+
+#define OS_POOL_ALIGN_UP(x, a) (((uintptr_t)(x) + ((a) - 1U)) & ~(uintptr_t)((a) - 1U))
+
+/*
+ * ThreadX keeps a pointer in front of every block. Sizing the block so that block plus
+ * header is a multiple of OSAL_POOL_ALIGN, and starting the pool one header before an
+ * aligned address, puts every block on an OSAL_POOL_ALIGN boundary.
+ */
+typedef struct
+{
+    TX_BLOCK_POOL pool;
+    UCHAR *pool_start;
+    ULONG pool_size;
+    size_t block_size;
+    uint32_t block_count;
+    uint32_t in_use;
+    uint32_t high_water;
+    uint32_t failures;
+} os_pool_wrapper_t;
+
+int32_t os_pool_create_impl(size_t block_size, uint32_t block_count, osal_pool_handle_t *p_pool_handle)
+{
+    int32_t ret;
+    UINT status;
+    os_pool_wrapper_t *wrapper;
+    ULONG tx_block_size = (ULONG)(OS_POOL_ALIGN_UP(block_size + sizeof(UCHAR *), OSAL_POOL_ALIGN) - sizeof(UCHAR *));
+    ULONG pool_size = (tx_block_size + sizeof(UCHAR *)) * block_count;
+    size_t ctrl_size = OS_POOL_ALIGN_UP(sizeof(os_pool_wrapper_t) + sizeof(UCHAR *), OSAL_POOL_ALIGN);
+
+    wrapper = (os_pool_wrapper_t *)os_heap_malloc_impl(ctrl_size + pool_size);
+    if (wrapper == NULL)
+    {
+        return OSAL_ERROR;
+    }
+    memset(wrapper, 0, sizeof(os_pool_wrapper_t));
+    wrapper->pool_start = (UCHAR *)wrapper + ctrl_size - sizeof(UCHAR *);
+    wrapper->pool_size = pool_size;
+    wrapper->block_size = block_size;
+    wrapper->block_count = block_count;
+
+    status = tx_block_pool_create(&wrapper->pool, "osal_pool", tx_block_size, wrapper->pool_start, pool_size);
+    if (status == TX_SUCCESS)
+    {
+        *p_pool_handle = (osal_pool_handle_t)wrapper;
+        ret = OSAL_SUCCESS;
+    }
+    else
+    {
+        os_heap_free_impl(wrapper);
+        ret = OSAL_ERROR;
+    }
+    return ret;
+}
+
+int32_t os_pool_delete_impl(osal_pool_handle_t pool_handle)
+{
+    os_pool_wrapper_t *wrapper = (os_pool_wrapper_t *)pool_handle;
+    if (tx_block_pool_delete(&wrapper->pool) != TX_SUCCESS)
+    {
+        return OSAL_ERROR;
+    }
+    os_heap_free_impl(wrapper);
+    return OSAL_SUCCESS;
+}
+
+void *os_pool_alloc_impl(osal_pool_handle_t pool_handle, osal_tick_type_t timeout)
+{
+    os_pool_wrapper_t *wrapper = (os_pool_wrapper_t *)pool_handle;
+    VOID *block = TX_NULL;
+    ULONG wait_option = OSAL_IS_IN_ISR() ? TX_NO_WAIT : OS_MS_TO_TICKS(timeout);
+    UINT status = tx_block_allocate(&wrapper->pool, &block, wait_option);
+
+    UINT posture = OS_THREADX_PROTECT();
+    if (status == TX_SUCCESS)
+    {
+        wrapper->in_use++;
+        if (wrapper->in_use > wrapper->high_water)
+        {
+            wrapper->high_water = wrapper->in_use;
+        }
+    }
+    else
+    {
+        block = TX_NULL;
+        wrapper->failures++;
+    }
+    OS_THREADX_UNPROTECT(posture);
+    return block;
+}
+
+int32_t os_pool_free_impl(osal_pool_handle_t pool_handle, void *block)
+{
+    os_pool_wrapper_t *wrapper = (os_pool_wrapper_t *)pool_handle;
+    uintptr_t offset = (uintptr_t)block - (uintptr_t)wrapper->pool_start - sizeof(UCHAR *);
+    uintptr_t stride = wrapper->pool_size / wrapper->block_count;
+
+    /* tx_block_release() trusts the header in front of the block, validate before handing it over. */
+    if ((uintptr_t)block < (uintptr_t)wrapper->pool_start + sizeof(UCHAR *)
+        || offset >= wrapper->pool_size
+        || (offset % stride) != 0U)
+    {
+        return OSAL_ERR_BAD_ADDRESS;
+    }
+
+    UINT posture = OS_THREADX_PROTECT();
+    wrapper->in_use--;
+    OS_THREADX_UNPROTECT(posture);
+
+    return (tx_block_release(block) == TX_SUCCESS) ? OSAL_SUCCESS : OSAL_ERROR;
+}
+
+void os_pool_get_stats_impl(osal_pool_handle_t pool_handle, osal_pool_stats_t *p_stats)
+{
+    os_pool_wrapper_t *wrapper = (os_pool_wrapper_t *)pool_handle;
+    UINT posture = OS_THREADX_PROTECT();
+    p_stats->block_size = wrapper->block_size;
+    p_stats->block_count = wrapper->block_count;
+    p_stats->in_use = wrapper->in_use;
+    p_stats->high_water = wrapper->high_water;
+    p_stats->failures = wrapper->failures;
+    OS_THREADX_UNPROTECT(posture);
+}
+
+#endif // OSAL_RTOS_SUPPORT
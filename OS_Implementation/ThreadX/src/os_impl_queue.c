@@ -1,60 +1,93 @@
 #include "osal_internal_queue.h"
 #include "os_threadx.h"
 #include "osal_internal_heap.h"
+#include "osal_internal_task.h"
 
 #if (OSAL_RTOS_SUPPORT == THREADX_SUPPORT)
 
+/* queue stays the first member, the handle is used as a TX_QUEUE * everywhere else. */
+typedef struct
+{
+    TX_QUEUE queue;
+    uint8_t allocated;   // control block and storage share one OSAL heap block
+} os_queue_wrapper_t;
+
+OSAL_STATIC_ASSERT(sizeof(osal_queue_static_t) >= sizeof(os_queue_wrapper_t), queue_static_size);
+
+/* Message storage starts on the cache line after the control block. */
+#define OS_QUEUE_STORAGE_OFFSET \
+    ((sizeof(os_queue_wrapper_t) + OSAL_CACHE_LINE_SIZE - 1U) & ~(size_t)(OSAL_CACHE_LINE_SIZE - 1U))
+
 int32_t os_queue_create_impl( size_t queue_depth, size_t data_size, osal_queue_handle_t *p_queue_handle)
 {
     int32_t ret;
-    TX_QUEUE *cur_queue_handle;
-    
-    cur_queue_handle = (TX_QUEUE *)os_heap_malloc_impl(sizeof(TX_QUEUE));
+    os_queue_wrapper_t *cur_queue_handle;
+    /* ThreadX counts message sizes in ULONGs, rounded up. */
+    ULONG message_size_ulongs = (data_size + sizeof(ULONG) - 1) / sizeof(ULONG);
+    ULONG queue_size;
+
+    if (message_size_ulongs == 0U || queue_depth > (SIZE_MAX - OS_QUEUE_STORAGE_OFFSET) / (message_size_ulongs * sizeof(ULONG)))
+    {
+        return OSAL_ERR_INVALID_SIZE;
+    }
+    queue_size = queue_depth * message_size_ulongs * sizeof(ULONG);
+
+    cur_queue_handle = (os_queue_wrapper_t *)os_heap_malloc_aligned_impl(OS_QUEUE_STORAGE_OFFSET + queue_size, OSAL_CACHE_LINE_SIZE);
     if (cur_queue_handle == NULL)
     {
         ret = OSAL_ERROR;
     }
     else
     {
-        /* ThreadX queue memory requirement calculation
-           Message size = number of ULONGs needed (must round up)
-           Queue memory = queue_depth * message_size_in_ulongs * sizeof(ULONG) */
-        ULONG message_size_ulongs = (data_size + sizeof(ULONG) - 1) / sizeof(ULONG);
-        ULONG queue_size = queue_depth * message_size_ulongs * sizeof(ULONG);
-        VOID *queue_memory = os_heap_malloc_impl(queue_size);
-        
-        if (queue_memory == NULL)
+        memset(cur_queue_handle, 0, sizeof(os_queue_wrapper_t));
+        UINT status = tx_queue_create(&cur_queue_handle->queue, "queue", message_size_ulongs,
+                                      (VOID *)((uint8_t *)cur_queue_handle + OS_QUEUE_STORAGE_OFFSET), queue_size);
+        if (status != TX_SUCCESS)
         {
             os_heap_free_impl(cur_queue_handle);
             ret = OSAL_ERROR;
         }
         else
         {
-            UINT status = tx_queue_create(cur_queue_handle, "queue", message_size_ulongs, 
-                                         (VOID *)queue_memory, queue_size);
-            if (status != TX_SUCCESS)
-            {
-                os_heap_free_impl(queue_memory);
-                os_heap_free_impl(cur_queue_handle);
-                ret = OSAL_ERROR;
-            }
-            else
-            {
-                *p_queue_handle = (osal_queue_handle_t)cur_queue_handle;
-                ret = OSAL_SUCCESS;
-            }
+            cur_queue_handle->allocated = 1U;
+            *p_queue_handle = (osal_queue_handle_t)cur_queue_handle;
+            ret = OSAL_SUCCESS;
         }
     }
     return ret;
 }
 
+int32_t os_queue_create_static_impl(size_t queue_depth, size_t data_size, void *storage, void *cb_memory, osal_queue_handle_t *p_queue_handle)
+{
+    int32_t ret;
+    os_queue_wrapper_t *cur_queue_handle = (os_queue_wrapper_t *)cb_memory;
+    ULONG message_size_ulongs = (data_size + sizeof(ULONG) - 1) / sizeof(ULONG);
+    ULONG queue_size = queue_depth * message_size_ulongs * sizeof(ULONG);
+
+    memset(cur_queue_handle, 0, sizeof(os_queue_wrapper_t));
+    UINT status = tx_queue_create(&cur_queue_handle->queue, "queue", message_size_ulongs, (VOID *)storage, queue_size);
+    if (status != TX_SUCCESS)
+    {
+        ret = OSAL_ERROR;
+    }
+    else
+    {
+        *p_queue_handle = (osal_queue_handle_t)cur_queue_handle;
+        ret = OSAL_SUCCESS;
+    }
+    return ret;
+}
+
 void os_queue_delete_impl(osal_queue_handle_t queue_handle)
 {
-    TX_QUEUE *handle = (TX_QUEUE *)queue_handle;
+    os_queue_wrapper_t *handle = (os_queue_wrapper_t *)queue_handle;
     if (handle != NULL)
     {
-        tx_queue_delete(handle);
-        os_heap_free_impl(handle);
+        tx_queue_delete(&handle->queue);
+        if (handle->allocated != 0U)
+        {
+            os_heap_free_impl(handle);
+        }
     }
 }
 
@@ -121,4 +154,109 @@ int32_t os_queue_msg_waiting_impl(osal_queue_handle_t queue_handle)
     return ret;
 }
 
+/*
+ * ThreadX copies whole ULONG messages. When data_size is not a multiple of ULONG, messages
+ * go through a bounce buffer so the caller's array is neither over-read nor overrun.
+ * TX_16_ULONG is the largest ThreadX message.
+ */
+static UINT os_queue_send_one(TX_QUEUE *handle, const uint8_t *src, size_t data_size, ULONG wait_option)
+{
+    ULONG bounce[TX_16_ULONG];
+    if ((data_size % sizeof(ULONG)) == 0U)
+    {
+        return tx_queue_send(handle, (VOID *)src, wait_option);
+    }
+    memcpy(bounce, src, data_size);
+    return tx_queue_send(handle, bounce, wait_option);
+}
+
+static UINT os_queue_receive_one(TX_QUEUE *handle, uint8_t *dst, size_t data_size, ULONG wait_option)
+{
+    ULONG bounce[TX_16_ULONG];
+    UINT status;
+    if ((data_size % sizeof(ULONG)) == 0U)
+    {
+        return tx_queue_receive(handle, dst, wait_option);
+    }
+    status = tx_queue_receive(handle, bounce, wait_option);
+    if (status == TX_SUCCESS)
+    {
+        memcpy(dst, bounce, data_size);
+    }
+    return status;
+}
+
+/*
+ * The scheduler lock keeps the calling thread running until the whole batch is moved.
+ * Without it the batch still completes, other threads may just interleave.
+ */
+size_t os_queue_send_many_impl(osal_queue_handle_t queue_handle, const void *data, size_t data_size, size_t count, osal_tick_type_t timeout)
+{
+    size_t sent = 0;
+    const uint8_t *p_data = (const uint8_t *)data;
+    TX_QUEUE *handle = (TX_QUEUE *)queue_handle;
+    bool locked;
+
+    if (handle == NULL || data == NULL || count == 0U || data_size > TX_16_ULONG * sizeof(ULONG))
+    {
+        return 0;
+    }
+
+    /* Only the first message may block. */
+    if (OSAL_IS_IN_ISR())
+    {
+        timeout = 0;
+    }
+    if (os_queue_send_one(handle, p_data, data_size, OS_MS_TO_TICKS(timeout)) != TX_SUCCESS)
+    {
+        return 0;
+    }
+    sent = 1;
+
+    locked = (os_sched_lock_impl() == OSAL_SUCCESS);
+    while (sent < count && os_queue_send_one(handle, &p_data[sent * data_size], data_size, TX_NO_WAIT) == TX_SUCCESS)
+    {
+        sent++;
+    }
+    if (locked)
+    {
+        (void)os_sched_unlock_impl();
+    }
+    return sent;
+}
+
+size_t os_queue_receive_many_impl(osal_queue_handle_t queue_handle, void *data, size_t data_size, size_t count, osal_tick_type_t timeout)
+{
+    size_t received = 0;
+    uint8_t *p_data = (uint8_t *)data;
+    TX_QUEUE *handle = (TX_QUEUE *)queue_handle;
+    bool locked;
+
+    if (handle == NULL || data == NULL || count == 0U || data_size > TX_16_ULONG * sizeof(ULONG))
+    {
+        return 0;
+    }
+
+    if (OSAL_IS_IN_ISR())
+    {
+        timeout = 0;
+    }
+    if (os_queue_receive_one(handle, p_data, data_size, OS_MS_TO_TICKS(timeout)) != TX_SUCCESS)
+    {
+        return 0;
+    }
+    received = 1;
+
+    locked = (os_sched_lock_impl() == OSAL_SUCCESS);
+    while (received < count && os_queue_receive_one(handle, &p_data[received * data_size], data_size, TX_NO_WAIT) == TX_SUCCESS)
+    {
+        received++;
+    }
+    if (locked)
+    {
+        (void)os_sched_unlock_impl();
+    }
+    return received;
+}
+
 #endif // OSAL_RTOS_SUPPORT
@@ -4,18 +4,6 @@
 
 #if (OSAL_RTOS_SUPPORT == THREADX_SUPPORT)
 
-/*
- * Semaphore wrapper structure
- * Both binary and counting semaphores use TX_SEMAPHORE
- * Binary semaphore: max_count = 1, initial_count = 0
- * Counting semaphore: max_count = user specified, initial_count = user specified
- */
-typedef struct 
-{
-    TX_SEMAPHORE semaphore;
-    uint32_t max_count;  // Max count: 1 for binary, custom for counting
-} os_sema_wrapper_t;
-
 int32_t os_sema_binary_create_impl(osal_sema_handle_t *p_sema_handle)
 {
     int32_t ret;
@@ -38,6 +26,7 @@ int32_t os_sema_binary_create_impl(osal_sema_handle_t *p_sema_handle)
         else
         {
             wrapper->max_count = 1;  // Binary semaphore max is 1
+            wrapper->allocated = 1U;
             *p_sema_handle = (osal_sema_handle_t)wrapper;
             ret = OSAL_SUCCESS;
         }
@@ -67,6 +56,7 @@ int32_t os_sema_countings_create_impl(osal_sema_handle_t *p_sema_handle, uint32_
         else
         {
             wrapper->max_count = max_count;  // Store max_count for checking on give
+            wrapper->allocated = 1U;
             *p_sema_handle = (osal_sema_handle_t)wrapper;
             ret = OSAL_SUCCESS;
         }
@@ -74,13 +64,43 @@ int32_t os_sema_countings_create_impl(osal_sema_handle_t *p_sema_handle, uint32_
     return ret;
 }
 
+OSAL_STATIC_ASSERT(sizeof(osal_sema_static_t) >= sizeof(os_sema_wrapper_t), sema_static_size);
+
+int32_t os_sema_countings_create_static_impl(osal_sema_handle_t *p_sema_handle, uint32_t max_count, uint32_t init_count, void *cb_memory)
+{
+    int32_t ret;
+    os_sema_wrapper_t *wrapper = (os_sema_wrapper_t *)cb_memory;
+
+    memset(wrapper, 0, sizeof(os_sema_wrapper_t));
+    UINT status = tx_semaphore_create(&wrapper->semaphore, "counting_sema", init_count);
+    if (status != TX_SUCCESS)
+    {
+        ret = OSAL_ERROR;
+    }
+    else
+    {
+        wrapper->max_count = max_count;
+        *p_sema_handle = (osal_sema_handle_t)wrapper;
+        ret = OSAL_SUCCESS;
+    }
+    return ret;
+}
+
+int32_t os_sema_binary_create_static_impl(osal_sema_handle_t *p_sema_handle, void *cb_memory)
+{
+    return os_sema_countings_create_static_impl(p_sema_handle, 1U, 0U, cb_memory);
+}
+
 void os_sema_delete_impl(osal_sema_handle_t sema_handle)
 {
     os_sema_wrapper_t *wrapper = (os_sema_wrapper_t *)sema_handle;
     if (wrapper != NULL)
     {
         tx_semaphore_delete(&wrapper->semaphore);
-        os_heap_free_impl(wrapper);
+        if (wrapper->allocated != 0U)
+        {
+            os_heap_free_impl(wrapper);
+        }
     }
 }
 
@@ -5,6 +5,11 @@
 
 #if (OSAL_RTOS_SUPPORT == THREADX_SUPPORT)
 
+#include "tx_thread.h"          // _tx_thread_created_ptr, the list of all threads
+#ifdef TX_EXECUTION_PROFILE_ENABLE
+#include "tx_execution_profile.h"
+#endif
+
 #define OSAL_MAX_NAME_LEN 16
 #define OSAL_CHECK_APINAME(str) OSAL_CHECK_STRING(str, OSAL_MAX_NAME_LEN, OSAL_ERR_NAME_TOO_LONG)
 
@@ -15,13 +20,120 @@ typedef struct {
 } task_wrapper_arg_t;
 
 typedef struct {
+    UINT depth;                          // osal_sched_lock() nesting
+    UINT threshold;                      // preemption threshold to restore at the last unlock
+} os_sched_lock_t;
+
+/* thread must stay the first member, tx_thread_identify() is mapped back to the handle. */
+typedef struct osal_threadx_task_handle {
     TX_THREAD thread;
     osal_stackptr_t stack_pointer;
     size_t stack_size;
-    uint8_t stack_allocated;
+    void *heap_block;                    // OSAL heap block holding the stack and/or this handle, NULL when static
     task_wrapper_arg_t wrapper;
+    TX_EVENT_FLAGS_GROUP notify_event;   // bit 0 wakes the owner, the state lives below
+    ULONG notify_value;
+    UINT notify_pending;
+    void *tls[OSAL_TASK_TLS_COUNT];
+    os_sched_lock_t sched_lock;
+    struct osal_threadx_task_handle *reap_next;   // os_task_reap_list, once the thread ended itself
 } osal_threadx_task_handle_t;
 
+/* Lock state of threads not created through the OSAL (tx_application_define() and friends). */
+#define OS_SCHED_LOCK_FOREIGN_MAX  4
+
+typedef struct {
+    TX_THREAD *thread;
+    os_sched_lock_t lock;
+} os_sched_lock_foreign_t;
+
+static os_sched_lock_foreign_t os_sched_lock_foreign[OS_SCHED_LOCK_FOREIGN_MAX];
+
+#define OS_TASK_NOTIFY_FLAG  (0x1UL)
+
+OSAL_STATIC_ASSERT(sizeof(osal_task_static_t) >= sizeof(osal_threadx_task_handle_t), task_static_size);
+
+/* The handle goes after the stack, on its own cache line, so an overflowing stack misses the TCB. */
+#define OS_TASK_ROUND_UP(size)  (((size) + OSAL_CACHE_LINE_SIZE - 1U) & ~(size_t)(OSAL_CACHE_LINE_SIZE - 1U))
+
+static void os_task_handle_free(osal_threadx_task_handle_t *handle)
+{
+    void *heap_block = handle->heap_block;   // may contain the handle itself
+    if (heap_block != NULL)
+    {
+        os_heap_free_impl(heap_block);
+    }
+}
+
+/* After a successful tx_thread_delete(), the thread can no longer run. */
+static void os_task_destroy(osal_threadx_task_handle_t *handle)
+{
+    tx_event_flags_delete(&handle->notify_event);
+#if (OSAL_HEAP_CACHE_ENABLE == 1)
+    osal_heap_cache_release(handle->tls[OSAL_TASK_TLS_HEAP_CACHE]);
+#endif
+    os_task_handle_free(handle);
+}
+
+/*
+ * A thread cannot delete itself in ThreadX. It queues its handle here and terminates, the next
+ * task create or delete from another thread deletes it and frees its memory.
+ */
+static osal_threadx_task_handle_t *os_task_reap_list = NULL;
+
+static void os_task_reap_push(osal_threadx_task_handle_t *handle)
+{
+    UINT posture = OS_THREADX_PROTECT();
+    handle->reap_next = os_task_reap_list;
+    os_task_reap_list = handle;
+    OS_THREADX_UNPROTECT(posture);
+}
+
+/* Takes handle off the reap list if it queued itself there. */
+static void os_task_reap_unlink(osal_threadx_task_handle_t *handle)
+{
+    UINT posture = OS_THREADX_PROTECT();
+    for (osal_threadx_task_handle_t **link = &os_task_reap_list; *link != NULL; link = &(*link)->reap_next)
+    {
+        if (*link == handle)
+        {
+            *link = handle->reap_next;
+            break;
+        }
+    }
+    OS_THREADX_UNPROTECT(posture);
+}
+
+static void os_task_reap(void)
+{
+    UINT posture = OS_THREADX_PROTECT();
+    osal_threadx_task_handle_t *handle = os_task_reap_list;
+    os_task_reap_list = NULL;
+    OS_THREADX_UNPROTECT(posture);
+
+    while (handle != NULL)
+    {
+        osal_threadx_task_handle_t *next = handle->reap_next;
+        if (tx_thread_delete(&handle->thread) == TX_SUCCESS)
+        {
+            os_task_destroy(handle);
+        }
+        else
+        {
+            /* Queued but not terminated yet, the next pass gets it. */
+            os_task_reap_push(handle);
+        }
+        handle = next;
+    }
+}
+
+/* Does not return. */
+static void os_task_exit(osal_threadx_task_handle_t *handle)
+{
+    os_task_reap_push(handle);
+    tx_thread_terminate(&handle->thread);
+}
+
 static void task_entry_wrapper(ULONG arg)
 {
     task_wrapper_arg_t *wrapper = (task_wrapper_arg_t *)arg;
@@ -29,6 +141,24 @@ static void task_entry_wrapper(ULONG arg)
     {
         wrapper->original_func(wrapper->original_arg);
     }
+    /* Returning would leave a completed thread and its memory behind. */
+    os_task_exit((osal_threadx_task_handle_t *)tx_thread_identify());
+}
+
+static bool os_task_is_osal_thread(const TX_THREAD *thread)
+{
+    return (thread->tx_thread_entry == task_entry_wrapper);
+}
+
+static void os_task_core_exclude(TX_THREAD *thread, osal_core_mask_t core_mask)
+{
+#ifdef TX_THREAD_SMP_MAX_CORES
+    ULONG all = (TX_THREAD_SMP_MAX_CORES >= 32) ? 0xFFFFFFFFUL : ((1UL << TX_THREAD_SMP_MAX_CORES) - 1UL);
+    tx_thread_smp_core_exclude(thread, all & ~(ULONG)core_mask);
+#else
+    (void)thread;
+    (void)core_mask;
+#endif
 }
 
 int32_t os_task_create_impl(osal_task_internal_record_t *p_task)
@@ -36,24 +166,47 @@ int32_t os_task_create_impl(osal_task_internal_record_t *p_task)
     int32_t ret = OSAL_SUCCESS;
     OSAL_CHECK_APINAME(p_task->task_name);
 
-    osal_threadx_task_handle_t *handle = (osal_threadx_task_handle_t *)os_heap_malloc_impl(sizeof(osal_threadx_task_handle_t));
-    if (handle == NULL)
+    osal_threadx_task_handle_t *handle = (osal_threadx_task_handle_t *)p_task->cb_memory;
+    void *heap_block = NULL;
+
+    os_task_reap();
+
+    if (handle == NULL && p_task->stack_pointer == NULL)
     {
-        return OSAL_ERROR;
+        /* One cache aligned block, [stack | handle]. */
+        size_t stack_span = OS_TASK_ROUND_UP(p_task->stack_size);
+        if (stack_span < p_task->stack_size || stack_span > SIZE_MAX - sizeof(osal_threadx_task_handle_t))
+        {
+            return OSAL_ERR_INVALID_SIZE;
+        }
+        heap_block = os_heap_malloc_aligned_impl(stack_span + sizeof(osal_threadx_task_handle_t), OSAL_CACHE_LINE_SIZE);
+        if (heap_block == NULL)
+        {
+            return OSAL_ERROR;
+        }
+        p_task->stack_pointer = (osal_stackptr_t)heap_block;
+        handle = (osal_threadx_task_handle_t *)((uint8_t *)heap_block + stack_span);
     }
-    memset(handle, 0, sizeof(osal_threadx_task_handle_t));
-
-    /* Allocate stack memory */
-    if (p_task->stack_pointer == NULL)
+    else if (handle == NULL)
     {
-        p_task->stack_pointer = (osal_stackptr_t)os_heap_malloc_impl(p_task->stack_size);
-        if (p_task->stack_pointer == NULL)
+        heap_block = os_heap_malloc_impl(sizeof(osal_threadx_task_handle_t));
+        handle = (osal_threadx_task_handle_t *)heap_block;
+    }
+    else if (p_task->stack_pointer == NULL)
+    {
+        heap_block = os_heap_malloc_impl(p_task->stack_size);
+        p_task->stack_pointer = (osal_stackptr_t)heap_block;
+        if (heap_block == NULL)
         {
-            os_heap_free_impl(handle);
             return OSAL_ERROR;
         }
-        handle->stack_allocated = 1U;
     }
+    if (handle == NULL)
+    {
+        return OSAL_ERROR;
+    }
+    memset(handle, 0, sizeof(osal_threadx_task_handle_t));
+    handle->heap_block = heap_block;
 
     handle->stack_pointer = p_task->stack_pointer;
     handle->stack_size = p_task->stack_size;
@@ -61,6 +214,15 @@ int32_t os_task_create_impl(osal_task_internal_record_t *p_task)
     handle->wrapper.original_func = p_task->entry_function_pointer;
     handle->wrapper.original_arg = p_task->entry_arg;
 
+    /* Created first, the thread may be notified as soon as it exists. */
+    if (tx_event_flags_create(&handle->notify_event, (CHAR *)p_task->task_name) != TX_SUCCESS)
+    {
+        os_task_handle_free(handle);
+        return OSAL_ERROR;
+    }
+
+    /* A pinned thread is created stopped and released once its cores are set. */
+    UINT auto_start = (p_task->core_mask == OSAL_CORE_MASK_ANY) ? TX_AUTO_START : TX_DONT_START;
     UINT status = tx_thread_create(&handle->thread, (CHAR *)p_task->task_name,
                                    task_entry_wrapper, (ULONG)&handle->wrapper,
                                    handle->stack_pointer,  /* Stack pointer */
@@ -68,15 +230,12 @@ int32_t os_task_create_impl(osal_task_internal_record_t *p_task)
                                    p_task->priority,
                                    p_task->priority,
                                    TX_NO_TIME_SLICE,
-                                   TX_AUTO_START);
+                                   auto_start);
     
     if (status != TX_SUCCESS)
     {
-        if (handle->stack_allocated != 0U)
-        {
-            os_heap_free_impl(handle->stack_pointer);
-        }
-        os_heap_free_impl(handle);
+        tx_event_flags_delete(&handle->notify_event);
+        os_task_handle_free(handle);
         ret = OSAL_ERROR;
     }
     else
@@ -85,6 +244,11 @@ int32_t os_task_create_impl(osal_task_internal_record_t *p_task)
         {
             *(p_task->p_task_handle) = (osal_task_handle_t)handle;
         }
+        if (auto_start == TX_DONT_START)
+        {
+            os_task_core_exclude(&handle->thread, p_task->core_mask);
+            tx_thread_resume(&handle->thread);
+        }
         ret = OSAL_SUCCESS;
     }
     return ret;
@@ -93,16 +257,60 @@ int32_t os_task_create_impl(osal_task_internal_record_t *p_task)
 void os_task_delete_impl(osal_task_handle_t task_handle)
 {
     osal_threadx_task_handle_t *handle = (osal_threadx_task_handle_t *)task_handle;
-    if (handle != NULL)
+    TX_THREAD *self = tx_thread_identify();
+
+    if (handle == NULL || &handle->thread == self)
     {
-        tx_thread_delete(&handle->thread);
-        if (handle->stack_allocated != 0U)
+        if (self != TX_NULL && os_task_is_osal_thread(self))
         {
-            os_heap_free_impl(handle->stack_pointer);
-            handle->stack_allocated = 0U;
+            os_task_exit((osal_threadx_task_handle_t *)self);
         }
-        os_heap_free_impl(handle);
+        else if (self != TX_NULL)
+        {
+            tx_thread_terminate(self);    // not ours, its memory belongs to whoever created it
+        }
+        return;
+    }
+    /*
+     * tx_thread_delete() only accepts terminated or completed threads. Once terminated the target
+     * cannot queue itself any more, take it off the reap list so it is freed here and only here.
+     */
+    tx_thread_terminate(&handle->thread);
+    os_task_reap_unlink(handle);
+    if (tx_thread_delete(&handle->thread) == TX_SUCCESS)
+    {
+        os_task_destroy(handle);
     }
+    os_task_reap();
+}
+
+int32_t os_task_set_affinity_impl(osal_task_handle_t task_handle, osal_core_mask_t core_mask)
+{
+    TX_THREAD *thread = (task_handle != NULL) ? &((osal_threadx_task_handle_t *)task_handle)->thread : tx_thread_identify();
+    if (thread == TX_NULL)
+    {
+        return OSAL_INVALID_POINTER;
+    }
+    os_task_core_exclude(thread, core_mask);
+    return OSAL_SUCCESS;
+}
+
+uint32_t os_task_get_core_impl(void)
+{
+#ifdef TX_THREAD_SMP_MAX_CORES
+    return (uint32_t)tx_thread_smp_core_get();
+#else
+    return 0U;
+#endif
+}
+
+uint32_t os_task_core_count_impl(void)
+{
+#ifdef TX_THREAD_SMP_MAX_CORES
+    return (uint32_t)TX_THREAD_SMP_MAX_CORES;
+#else
+    return 1U;
+#endif
 }
 
 void os_task_start_impl(void)
@@ -121,14 +329,6 @@ void os_task_suspend_impl(osal_task_handle_t task_handle)
     }
 }
 
-void os_task_suspend_all_impl(void)
-{
-    // ThreadX does not have a direct equivalent to suspend all tasks
-    // Use critical section to disable task switching
-    // Note: This is a simplified implementation
-    // In ThreadX, typically use mutex or semaphore for synchronization instead
-}
-
 void os_task_resume_impl(osal_task_handle_t task_handle)
 {
     osal_threadx_task_handle_t *handle = (osal_threadx_task_handle_t *)task_handle;
@@ -148,14 +348,35 @@ void os_task_delay_ms_impl(uint32_t ms)
     tx_thread_sleep(OS_MS_TO_TICKS(ms));
 }
 
+/* ThreadX only sleeps relative to now, the wake time is turned into a sleep length here. */
+int32_t os_task_delay_until_impl(osal_tick_type_t *p_last_wake, osal_tick_type_t period)
+{
+    osal_tick_type_t wake = (osal_tick_type_t)(*p_last_wake + period);
+    TX_THREAD *self = tx_thread_identify();
+    UINT threshold;
+    int32_t ret = OSAL_ERR_DEADLINE_MISSED;
+
+    *p_last_wake = wake;
+    /* No other thread may run between reading the time and going to sleep. */
+    tx_thread_preemption_change(self, 0, &threshold);
+    osal_tick_type_t now = (osal_tick_type_t)tx_time_get();
+    if (!osal_time_ticks_reached(now, wake))
+    {
+        tx_thread_sleep(osal_time_ticks_diff(wake, now));
+        ret = OSAL_SUCCESS;
+    }
+    tx_thread_preemption_change(self, threshold, &threshold);
+    return ret;
+}
+
 uint32_t os_enter_critical_impl(void)
 {
-    return tx_interrupt_control(TX_INT_DISABLE);
+    return OS_THREADX_PROTECT();
 }
 
 void os_exit_critical_impl(uint32_t primask)
 {
-    tx_interrupt_control(primask);
+    OS_THREADX_UNPROTECT(primask);
 }
 
 int32_t os_port_yield_impl(void)
@@ -189,4 +410,404 @@ osal_tick_type_t os_task_get_tick_count_impl(void)
     return os_ticks;
 }
 
+/* The calling thread's handle, NULL from ISRs and for threads not created through the OSAL. */
+static osal_threadx_task_handle_t *os_task_current_handle(void)
+{
+    TX_THREAD *self = tx_thread_identify();
+    if (OSAL_IS_IN_ISR() || self == TX_NULL || !os_task_is_osal_thread(self))
+    {
+        return NULL;
+    }
+    return (osal_threadx_task_handle_t *)self;
+}
+
+osal_task_handle_t os_task_get_current_impl(void)
+{
+    if (OSAL_IS_IN_ISR())
+    {
+        return NULL;
+    }
+    return (osal_task_handle_t)tx_thread_identify();
+}
+
+/* Foreign threads borrow a slot from the table while they hold the lock. */
+static os_sched_lock_t *os_sched_lock_state(TX_THREAD *self, bool claim)
+{
+    os_sched_lock_t *lock = NULL;
+    os_sched_lock_foreign_t *free_slot = NULL;
+    UINT posture;
+
+    if (os_task_is_osal_thread(self))
+    {
+        return &((osal_threadx_task_handle_t *)self)->sched_lock;
+    }
+    posture = OS_THREADX_PROTECT();
+    for (uint32_t i = 0; i < OS_SCHED_LOCK_FOREIGN_MAX; i++)
+    {
+        if (os_sched_lock_foreign[i].thread == self)
+        {
+            lock = &os_sched_lock_foreign[i].lock;
+            break;
+        }
+        if (os_sched_lock_foreign[i].thread == TX_NULL && free_slot == NULL)
+        {
+            free_slot = &os_sched_lock_foreign[i];
+        }
+    }
+    if (lock == NULL && claim && free_slot != NULL)
+    {
+        free_slot->thread = self;
+        free_slot->lock.depth = 0U;
+        lock = &free_slot->lock;
+    }
+    OS_THREADX_UNPROTECT(posture);
+    return lock;
+}
+
+static void os_sched_lock_release(TX_THREAD *self)
+{
+    UINT posture = OS_THREADX_PROTECT();
+    for (uint32_t i = 0; i < OS_SCHED_LOCK_FOREIGN_MAX; i++)
+    {
+        if (os_sched_lock_foreign[i].thread == self)
+        {
+            os_sched_lock_foreign[i].thread = TX_NULL;
+            break;
+        }
+    }
+    OS_THREADX_UNPROTECT(posture);
+}
+
+/*
+ * ThreadX has no scheduler lock, a preemption threshold of 0 lets no other thread preempt the
+ * owner. The threshold in place before the first lock comes back at the last unlock.
+ * Builds with TX_DISABLE_PREEMPTION_THRESHOLD reject the change and the lock fails.
+ */
+int32_t os_sched_lock_impl(void)
+{
+    TX_THREAD *self = tx_thread_identify();
+    os_sched_lock_t *lock;
+    UINT threshold;
+
+    if (self == TX_NULL || OSAL_IS_IN_ISR())
+    {
+        return OSAL_SUCCESS;    // before the kernel runs threads nothing can preempt
+    }
+    lock = os_sched_lock_state(self, true);
+    if (lock == NULL)
+    {
+        return OSAL_ERR_NO_FREE_IDS;
+    }
+    if (lock->depth == 0U)
+    {
+        if (tx_thread_preemption_change(self, 0, &threshold) != TX_SUCCESS)
+        {
+            if (!os_task_is_osal_thread(self))
+            {
+                os_sched_lock_release(self);
+            }
+            return OSAL_ERROR;
+        }
+        lock->threshold = threshold;
+    }
+    lock->depth++;
+    return OSAL_SUCCESS;
+}
+
+int32_t os_sched_unlock_impl(void)
+{
+    TX_THREAD *self = tx_thread_identify();
+    os_sched_lock_t *lock;
+    UINT threshold;
+
+    if (self == TX_NULL || OSAL_IS_IN_ISR())
+    {
+        return OSAL_SUCCESS;
+    }
+    lock = os_sched_lock_state(self, false);
+    if (lock == NULL || lock->depth == 0U)
+    {
+        return OSAL_ERR_INCORRECT_OBJ_STATE;
+    }
+    if (--lock->depth == 0U)
+    {
+        /* Threads made ready meanwhile preempt right here. */
+        tx_thread_preemption_change(self, lock->threshold, &threshold);
+        if (!os_task_is_osal_thread(self))
+        {
+            os_sched_lock_release(self);
+        }
+    }
+    return OSAL_SUCCESS;
+}
+
+osal_priority_t os_task_get_priority_impl(osal_task_handle_t task_handle)
+{
+    TX_THREAD *thread = (task_handle != NULL) ? &((osal_threadx_task_handle_t *)task_handle)->thread : tx_thread_identify();
+    return (thread != TX_NULL) ? (osal_priority_t)thread->tx_thread_priority : (osal_priority_t)TX_MAX_PRIORITIES;
+}
+
+int32_t os_task_tls_set_impl(uint32_t index, void *value)
+{
+    osal_threadx_task_handle_t *handle = os_task_current_handle();
+    if (handle == NULL || index >= OSAL_TASK_TLS_COUNT)
+    {
+        return OSAL_ERR_INCORRECT_OBJ_STATE;
+    }
+    handle->tls[index] = value;
+    return OSAL_SUCCESS;
+}
+
+void *os_task_tls_get_impl(uint32_t index)
+{
+    osal_threadx_task_handle_t *handle = os_task_current_handle();
+    if (handle == NULL || index >= OSAL_TASK_TLS_COUNT)
+    {
+        return NULL;
+    }
+    return handle->tls[index];
+}
+
+/* Bytes at the far end of the stack that still hold the fill pattern tx_thread_create() wrote. */
+static size_t os_task_stack_free(const TX_THREAD *thread)
+{
+#ifndef TX_DISABLE_STACK_FILLING
+    const uint8_t *p = (const uint8_t *)thread->tx_thread_stack_start;
+#ifdef TX_ENABLE_STACK_CHECKING
+    /* The deepest pointer seen at context switches bounds the scan. */
+    const uint8_t *end = (const uint8_t *)thread->tx_thread_stack_highest_ptr;
+#else
+    const uint8_t *end = (const uint8_t *)thread->tx_thread_stack_end;
+#endif
+    while (p < end && *p == (uint8_t)TX_STACK_FILL)
+    {
+        p++;
+    }
+    return (size_t)(p - (const uint8_t *)thread->tx_thread_stack_start);
+#else
+    (void)thread;
+    return OSAL_TASK_STACK_UNKNOWN;
+#endif
+}
+
+static void os_task_stats_fill(TX_THREAD *thread, osal_task_stats_t *p_stats)
+{
+    p_stats->handle = (osal_task_handle_t)thread;
+    if (thread->tx_thread_name != TX_NULL)
+    {
+        strncpy(p_stats->name, thread->tx_thread_name, sizeof(p_stats->name) - 1U);
+    }
+    switch (thread->tx_thread_state)
+    {
+        case TX_READY:
+            p_stats->state = (thread == tx_thread_identify()) ? OSAL_TASK_STATE_RUNNING : OSAL_TASK_STATE_READY;
+            break;
+        case TX_COMPLETED:
+        case TX_TERMINATED:
+            p_stats->state = OSAL_TASK_STATE_DELETED;
+            break;
+        case TX_SUSPENDED:
+            p_stats->state = OSAL_TASK_STATE_SUSPENDED;
+            break;
+        default:
+            p_stats->state = OSAL_TASK_STATE_BLOCKED;    // sleeping or waiting on an object
+            break;
+    }
+    p_stats->priority = (osal_priority_t)thread->tx_thread_priority;
+    p_stats->stack_size = (size_t)thread->tx_thread_stack_size;
+    p_stats->stack_free_min = os_task_stack_free(thread);
+    p_stats->switch_count = (uint32_t)thread->tx_thread_run_count;
+#ifdef TX_EXECUTION_PROFILE_ENABLE
+    EXECUTION_TIME run_time = 0;
+    _tx_execution_thread_time_get(thread, &run_time);
+    p_stats->run_time = (uint64_t)run_time;
+#endif
+}
+
+int32_t os_task_get_stats_impl(osal_task_handle_t task_handle, osal_task_stats_t *p_stats)
+{
+    TX_THREAD *thread = (TX_THREAD *)task_handle;
+    if (thread == TX_NULL)
+    {
+        return OSAL_INVALID_POINTER;
+    }
+    os_task_stats_fill(thread, p_stats);
+    return OSAL_SUCCESS;
+}
+
+size_t os_task_list_stats_impl(osal_task_stats_t *p_stats, size_t max_count, uint64_t *p_total_run_time)
+{
+    TX_THREAD *self = tx_thread_identify();
+    UINT threshold = 0;
+    size_t written = 0U;
+
+    /*
+     * Threads may not be created or deleted during the walk, the stack scans run with interrupts on.
+     * The threshold is saved locally, the caller need not be an OSAL thread.
+     */
+    if (self != TX_NULL)
+    {
+        tx_thread_preemption_change(self, 0, &threshold);
+    }
+    TX_THREAD *thread = _tx_thread_created_ptr;
+    for (ULONG i = 0; i < _tx_thread_created_count && written < max_count; i++)
+    {
+        os_task_stats_fill(thread, &p_stats[written]);
+        written++;
+        thread = thread->tx_thread_created_next;
+    }
+    if (self != TX_NULL)
+    {
+        tx_thread_preemption_change(self, threshold, &threshold);
+    }
+
+#ifdef TX_EXECUTION_PROFILE_ENABLE
+    if (p_total_run_time != NULL)
+    {
+        EXECUTION_TIME threads = 0;
+        EXECUTION_TIME isr = 0;
+        EXECUTION_TIME idle = 0;
+        _tx_execution_thread_total_time_get(&threads);
+        _tx_execution_isr_time_get(&isr);
+        _tx_execution_idle_time_get(&idle);
+        *p_total_run_time = (uint64_t)threads + (uint64_t)isr + (uint64_t)idle;
+    }
+#else
+    (void)p_total_run_time;
+#endif
+    return written;
+}
+
+static int32_t os_task_notify(osal_threadx_task_handle_t *handle, ULONG bits, bool increment)
+{
+    UINT posture = OS_THREADX_PROTECT();
+    if (increment)
+    {
+        handle->notify_value++;
+    }
+    else
+    {
+        handle->notify_value |= bits;
+    }
+    handle->notify_pending = 1U;
+    OS_THREADX_UNPROTECT(posture);
+
+    /* Safe from ISRs, a flag left over from an earlier notification only costs one extra check. */
+    return (tx_event_flags_set(&handle->notify_event, OS_TASK_NOTIFY_FLAG, TX_OR) == TX_SUCCESS) ? OSAL_SUCCESS : OSAL_ERROR;
+}
+
+/* Sleeps until the next notification or until wait_option ticks after start have passed. */
+static bool os_task_notify_block(osal_threadx_task_handle_t *handle, ULONG wait_option, ULONG start)
+{
+    ULONG actual_flags;
+    ULONG remaining = wait_option;
+
+    if (wait_option != TX_WAIT_FOREVER && wait_option != TX_NO_WAIT)
+    {
+        ULONG elapsed = tx_time_get() - start;
+        if (elapsed >= wait_option)
+        {
+            return false;
+        }
+        remaining = wait_option - elapsed;
+    }
+    return (tx_event_flags_get(&handle->notify_event, OS_TASK_NOTIFY_FLAG, TX_OR_CLEAR, &actual_flags, remaining) == TX_SUCCESS);
+}
+
+int32_t os_task_notify_give_impl(osal_task_handle_t task_handle)
+{
+    return os_task_notify((osal_threadx_task_handle_t *)task_handle, 0U, true);
+}
+
+int32_t os_task_notify_set_bits_impl(osal_task_handle_t task_handle, uint32_t bits)
+{
+    return os_task_notify((osal_threadx_task_handle_t *)task_handle, (ULONG)bits, false);
+}
+
+int32_t os_task_notify_take_impl(bool clear_on_exit, uint32_t *p_count, osal_tick_type_t timeout)
+{
+    osal_threadx_task_handle_t *handle = os_task_current_handle();
+    ULONG wait_option = OS_MS_TO_TICKS(timeout);
+    ULONG start = tx_time_get();
+
+    if (OSAL_IS_IN_ISR())
+    {
+        return OSAL_ERR_IN_ISR;
+    }
+    if (handle == NULL)
+    {
+        return OSAL_ERROR;
+    }
+
+    for (;;)
+    {
+        UINT posture = OS_THREADX_PROTECT();
+        ULONG count = handle->notify_value;
+        if (count != 0U)
+        {
+            handle->notify_value = clear_on_exit ? 0U : (count - 1U);
+            handle->notify_pending = 0U;
+            OS_THREADX_UNPROTECT(posture);
+            if (p_count != NULL)
+            {
+                *p_count = (uint32_t)count;
+            }
+            return OSAL_SUCCESS;
+        }
+        OS_THREADX_UNPROTECT(posture);
+
+        if (!os_task_notify_block(handle, wait_option, start))
+        {
+            return OSAL_ERROR_TIMEOUT;
+        }
+    }
+}
+
+int32_t os_task_notify_wait_impl(uint32_t clear_on_entry, uint32_t clear_on_exit, uint32_t *p_value, osal_tick_type_t timeout)
+{
+    osal_threadx_task_handle_t *handle = os_task_current_handle();
+    ULONG wait_option = OS_MS_TO_TICKS(timeout);
+    ULONG start = tx_time_get();
+    UINT posture;
+
+    if (OSAL_IS_IN_ISR())
+    {
+        return OSAL_ERR_IN_ISR;
+    }
+    if (handle == NULL)
+    {
+        return OSAL_ERROR;
+    }
+
+    posture = OS_THREADX_PROTECT();
+    if (handle->notify_pending == 0U)
+    {
+        handle->notify_value &= ~(ULONG)clear_on_entry;
+    }
+    OS_THREADX_UNPROTECT(posture);
+
+    for (;;)
+    {
+        posture = OS_THREADX_PROTECT();
+        if (handle->notify_pending != 0U)
+        {
+            ULONG value = handle->notify_value;
+            handle->notify_value &= ~(ULONG)clear_on_exit;
+            handle->notify_pending = 0U;
+            OS_THREADX_UNPROTECT(posture);
+            if (p_value != NULL)
+            {
+                *p_value = (uint32_t)value;
+            }
+            return OSAL_SUCCESS;
+        }
+        OS_THREADX_UNPROTECT(posture);
+
+        if (!os_task_notify_block(handle, wait_option, start))
+        {
+            return OSAL_ERROR_TIMEOUT;
+        }
+    }
+}
+
 #endif // OSAL_RTOS_SUPPORT
@@ -0,0 +1,30 @@
+#include "osal_internal_time.h"
+#include "os_threadx.h"
+//#include "app_log.h"
+
+#if (OSAL_RTOS_SUPPORT == THREADX_SUPPORT)
+
+/* tx_time_get() is 32 bits wide, wraps are counted here, which needs a read at least once per wrap (49 days at 1 kHz). */
+static ULONG os_time_last;
+static uint32_t os_time_wraps;
+
+osal_time_us_t os_time_now_us_impl(void)
+{
+    UINT primask = OS_THREADX_PROTECT();
+    ULONG now = tx_time_get();
+    if (now < os_time_last)
+    {
+        os_time_wraps++;
+    }
+    os_time_last = now;
+    uint64_t ticks = ((uint64_t)os_time_wraps << 32) | (uint64_t)(uint32_t)now;
+    OS_THREADX_UNPROTECT(primask);
+    return osal_time_ticks_to_us_at(ticks, TX_TIMER_TICKS_PER_SECOND);
+}
+
+uint32_t os_time_tick_rate_hz_impl(void)
+{
+    return TX_TIMER_TICKS_PER_SECOND;
+}
+
+#endif // OSAL_RTOS_SUPPORT
@@ -7,10 +7,20 @@
 
 typedef struct {
     TX_TIMER *tx_timer;
+    osal_timer_internal_record_t *timer_record;
     uint8_t auto_reload;
-    osal_tick_type_t timer_period;  /* Store timer period for os_timer_period_get_impl */
+    uint8_t allocated;              /* osal record, wrapper and TX_TIMER are one OSAL heap block */
+    osal_tick_type_t timer_period;  /* unit:ms, for os_timer_period_get_impl */
 } timer_wrapper_t;
 
+/* Kernel part of osal_timer_static_t, placed after the osal record, also by osal_timer_create(). */
+typedef struct {
+    timer_wrapper_t wrapper;
+    TX_TIMER tx_timer;
+} timer_static_t;
+
+OSAL_STATIC_ASSERT(OSAL_TIMER_STATIC_CB_SIZE >= sizeof(timer_static_t), timer_static_size);
+
 static void os_timer_cb(ULONG arg)
 {
     osal_timer_internal_record_t *timer_record = (osal_timer_internal_record_t *)arg;
@@ -50,23 +60,19 @@ static int32_t os_timer_restart_with_period(TX_TIMER *handle, uint32_t ticks, ui
 int32_t os_timer_create_impl(osal_timer_handle_t *p_timer_handle, osal_timer_internal_record_t *timer_record)
 {
     int32_t ret = OSAL_SUCCESS;
-    
-    /* Allocate wrapper structure */
-    timer_wrapper_t *wrapper = (timer_wrapper_t *)os_heap_malloc_impl(sizeof(timer_wrapper_t));
-    if (wrapper == NULL)
-    {
-        return OSAL_INVALID_POINTER;
-    }
-    
-    /* Allocate TX_TIMER */
-    wrapper->tx_timer = (TX_TIMER *)os_heap_malloc_impl(sizeof(TX_TIMER));
-    if (wrapper->tx_timer == NULL)
+    timer_static_t *storage = (timer_static_t *)timer_record->cb_memory;
+    timer_wrapper_t *wrapper;
+
+    if (storage == NULL)
     {
-        os_heap_free_impl(wrapper);
         return OSAL_INVALID_POINTER;
     }
+    wrapper = &storage->wrapper;
+    wrapper->tx_timer = &storage->tx_timer;
+    wrapper->allocated = timer_record->allocated;
     
     /* Store auto_reload flag in wrapper */
+    wrapper->timer_record = timer_record;
     wrapper->auto_reload = timer_record->auto_reload;
     wrapper->timer_period = timer_record->timer_period;
     
@@ -74,19 +80,18 @@ int32_t os_timer_create_impl(osal_timer_handle_t *p_timer_handle, osal_timer_int
     timer_record->timer_id.timer_handle = (osal_timer_handle_t)wrapper;
 
     UINT auto_activate = timer_record->auto_reload ? TX_AUTO_ACTIVATE : TX_NO_ACTIVATE;
-    UINT reschedule_ticks = timer_record->auto_reload ? timer_record->timer_period : 0;
+    ULONG period_ticks = OS_MS_TO_TICKS(timer_record->timer_period);
+    UINT reschedule_ticks = timer_record->auto_reload ? period_ticks : 0;
     UINT status = tx_timer_create(wrapper->tx_timer, 
                                   (CHAR *)timer_record->timer_name,
                                   os_timer_cb, 
                                   (ULONG)timer_record,
-                                  timer_record->timer_period,
+                                  period_ticks,
                                   reschedule_ticks,
                                   auto_activate);
     
     if (status != TX_SUCCESS)
     {
-        os_heap_free_impl(wrapper->tx_timer);
-        os_heap_free_impl(wrapper);
         ret = OSAL_INVALID_POINTER;
     }
     else
@@ -103,15 +108,9 @@ int32_t os_timer_start_impl(osal_timer_handle_t timer_handle, osal_tick_type_t t
     {
         return OSAL_ERROR;
     }
-    
-    /* Validate ticks_to_wait is not zero to avoid TX_ACTIVATE_ERROR */
-    if (ticks_to_wait == 0)
-    {
-        return OSAL_ERROR;
-    }
-    
-    /* Ensure timer is stopped before starting to avoid issues with already active timer */
-    return os_timer_restart_with_period(wrapper->tx_timer, OS_MS_TO_TICKS(ticks_to_wait), wrapper->auto_reload);
+
+    /* ThreadX timer calls never block, ticks_to_wait has nothing to bound. */
+    return os_timer_restart_with_period(wrapper->tx_timer, OS_MS_TO_TICKS(wrapper->timer_period), wrapper->auto_reload);
 }
 
 int32_t os_timer_stop_impl(osal_timer_handle_t timer_handle, osal_tick_type_t ticks_to_wait)
@@ -136,24 +135,15 @@ int32_t os_timer_stop_impl(osal_timer_handle_t timer_handle, osal_tick_type_t ti
 
 int32_t os_timer_period_change_impl(osal_timer_handle_t timer_handle, osal_tick_type_t new_period, osal_tick_type_t ticks_to_wait)
 {
-    int32_t ret = OSAL_SUCCESS;
-    UINT status;
-
     timer_wrapper_t *wrapper = (timer_wrapper_t *)timer_handle;
     if (wrapper == NULL || wrapper->tx_timer == NULL)
     {
         return OSAL_ERROR;
     }
 
-    // For periodic timer, both should be new_period; for one-shot, reschedule_ticks = 0
-    UINT reschedule_ticks = wrapper->auto_reload ? OS_MS_TO_TICKS(new_period) : 0;
-    status = tx_timer_change(wrapper->tx_timer, OS_MS_TO_TICKS(new_period), reschedule_ticks);
-    
-    if (status != TX_SUCCESS)
-    {
-        ret = OSAL_ERROR;
-    }
-    return ret;
+    /* Same as xTimerChangePeriod(): the new period applies from now and a dormant timer is started. */
+    wrapper->timer_period = new_period;
+    return os_timer_restart_with_period(wrapper->tx_timer, OS_MS_TO_TICKS(new_period), wrapper->auto_reload);
 }
 
 int32_t os_timer_delete_impl(osal_timer_handle_t timer_handle, osal_tick_type_t ticks_to_wait)
@@ -173,10 +163,9 @@ int32_t os_timer_delete_impl(osal_timer_handle_t timer_handle, osal_tick_type_t
     {
         ret = OSAL_ERROR;
     }
-    else
+    else if (wrapper->allocated != 0U)
     {
-        os_heap_free_impl(wrapper->tx_timer);
-        os_heap_free_impl(wrapper);
+        os_heap_free_impl(wrapper->timer_record);
     }
     return ret;
 }
@@ -190,7 +179,7 @@ int32_t os_timer_reset_impl(osal_timer_handle_t timer_handle, osal_tick_type_t t
     }
 
     // Deactivate and reactivate to reset
-    return os_timer_restart_with_period(wrapper->tx_timer, OS_MS_TO_TICKS(ticks_to_wait), wrapper->auto_reload);
+    return os_timer_restart_with_period(wrapper->tx_timer, OS_MS_TO_TICKS(wrapper->timer_period), wrapper->auto_reload);
 }
 
 osal_tick_type_t os_timer_period_get_impl(osal_timer_handle_t timer_handle)
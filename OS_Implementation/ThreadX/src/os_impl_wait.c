@@ -0,0 +1,248 @@
+#include "osal_internal_wait.h"
+#include "os_threadx.h"
+#include "osal_internal_heap.h"
+//#include "app_log.h"
+
+#if (OSAL_RTOS_SUPPORT == THREADX_SUPPORT)
+
+/*
+ * Wait set on top of the ThreadX notify callbacks
+ * Every member gets a send/put notify callback which posts the member pointer into the
+ * set's ready queue, osal_wait_any() is then a plain tx_queue_receive().
+ * ThreadX passes only the kernel object to the callback, the member table maps it back to its set.
+ */
+#define OS_WAIT_MSG_ULONGS ((sizeof(void *) + sizeof(ULONG) - 1U) / sizeof(ULONG))
+
+typedef struct
+{
+    TX_QUEUE ready_queue;
+} os_wait_set_t;
+
+typedef struct
+{
+    void *member;           // TX_QUEUE * or TX_SEMAPHORE *, equal to the osal handle
+    os_wait_set_t *set;
+    bool is_queue;
+} os_wait_member_t;
+
+static os_wait_member_t os_wait_members[OSAL_WAIT_SET_MAX_MEMBERS];
+
+static void os_wait_post(void *member)
+{
+    os_wait_set_t *set = NULL;
+    ULONG msg[OS_WAIT_MSG_ULONGS] = {0};
+    UINT posture = OS_THREADX_PROTECT();
+    for (uint32_t i = 0; i < OSAL_WAIT_SET_MAX_MEMBERS; i++)
+    {
+        if (os_wait_members[i].member == member)
+        {
+            set = os_wait_members[i].set;
+            break;
+        }
+    }
+    OS_THREADX_UNPROTECT(posture);
+
+    if (set != NULL)
+    {
+        memcpy(msg, &member, sizeof(member));
+        (void)tx_queue_send(&set->ready_queue, msg, TX_NO_WAIT);
+    }
+}
+
+static VOID os_wait_queue_notify(TX_QUEUE *queue_ptr)
+{
+    os_wait_post(queue_ptr);
+}
+
+static VOID os_wait_sema_notify(TX_SEMAPHORE *semaphore_ptr)
+{
+    os_wait_post(semaphore_ptr);
+}
+
+static int32_t os_wait_member_attach(os_wait_set_t *set, void *member, bool is_queue)
+{
+    int32_t ret = OSAL_SUCCESS;
+    os_wait_member_t *free_slot = NULL;
+    UINT posture = OS_THREADX_PROTECT();
+    for (uint32_t i = 0; i < OSAL_WAIT_SET_MAX_MEMBERS; i++)
+    {
+        if (os_wait_members[i].member == member)
+        {
+            ret = OSAL_ERR_OBJECT_IN_USE;
+            break;
+        }
+        if (os_wait_members[i].member == NULL && free_slot == NULL)
+        {
+            free_slot = &os_wait_members[i];
+        }
+    }
+    if (ret == OSAL_SUCCESS && free_slot == NULL)
+    {
+        ret = OSAL_ERR_NO_FREE_IDS;
+    }
+    if (ret == OSAL_SUCCESS)
+    {
+        free_slot->member = member;
+        free_slot->set = set;
+        free_slot->is_queue = is_queue;
+    }
+    OS_THREADX_UNPROTECT(posture);
+    return ret;
+}
+
+/* Clears the callback of a member attached to set, returns false when it was not attached. */
+static bool os_wait_member_detach(os_wait_set_t *set, void *member)
+{
+    bool found = false;
+    bool is_queue = false;
+    UINT posture = OS_THREADX_PROTECT();
+    for (uint32_t i = 0; i < OSAL_WAIT_SET_MAX_MEMBERS; i++)
+    {
+        if (os_wait_members[i].member == member && os_wait_members[i].set == set)
+        {
+            is_queue = os_wait_members[i].is_queue;
+            os_wait_members[i].member = NULL;
+            os_wait_members[i].set = NULL;
+            found = true;
+            break;
+        }
+    }
+    OS_THREADX_UNPROTECT(posture);
+
+    if (found && is_queue)
+    {
+        (void)tx_queue_send_notify((TX_QUEUE *)member, TX_NULL);
+    }
+    else if (found)
+    {
+        (void)tx_semaphore_put_notify((TX_SEMAPHORE *)member, TX_NULL);
+    }
+    return found;
+}
+
+int32_t os_wait_set_create_impl(size_t max_events, osal_wait_set_handle_t *p_set_handle)
+{
+    int32_t ret;
+    os_wait_set_t *cur_set_handle;
+    ULONG queue_size = (ULONG)(max_events * OS_WAIT_MSG_ULONGS * sizeof(ULONG));
+
+    cur_set_handle = (os_wait_set_t *)os_heap_malloc_impl(sizeof(os_wait_set_t) + queue_size);
+    if (cur_set_handle == NULL)
+    {
+        ret = OSAL_ERROR;
+    }
+    else if (tx_queue_create(&cur_set_handle->ready_queue, "wait_set", OS_WAIT_MSG_ULONGS,
+                             (VOID *)(cur_set_handle + 1), queue_size) != TX_SUCCESS)
+    {
+        os_heap_free_impl(cur_set_handle);
+        ret = OSAL_ERROR;
+    }
+    else
+    {
+        *p_set_handle = (osal_wait_set_handle_t)cur_set_handle;
+        ret = OSAL_SUCCESS;
+    }
+    return ret;
+}
+
+int32_t os_wait_set_delete_impl(osal_wait_set_handle_t set_handle)
+{
+    os_wait_set_t *set = (os_wait_set_t *)set_handle;
+
+    /* Detach whatever the caller left in the set. */
+    for (uint32_t i = 0; i < OSAL_WAIT_SET_MAX_MEMBERS; i++)
+    {
+        void *member = os_wait_members[i].member;
+        if (member != NULL && os_wait_members[i].set == set)
+        {
+            (void)os_wait_member_detach(set, member);
+        }
+    }
+    tx_queue_delete(&set->ready_queue);
+    os_heap_free_impl(set);
+    return OSAL_SUCCESS;
+}
+
+int32_t os_wait_set_add_queue_impl(osal_wait_set_handle_t set_handle, osal_queue_handle_t queue_handle)
+{
+    int32_t ret;
+    TX_QUEUE *queue = (TX_QUEUE *)queue_handle;
+    ULONG enqueued;
+
+    if (tx_queue_info_get(queue, NULL, &enqueued, NULL, NULL, NULL, NULL) != TX_SUCCESS || enqueued != 0U)
+    {
+        return OSAL_ERR_INCORRECT_OBJ_STATE;
+    }
+
+    ret = os_wait_member_attach((os_wait_set_t *)set_handle, queue, true);
+    if (ret == OSAL_SUCCESS && tx_queue_send_notify(queue, os_wait_queue_notify) != TX_SUCCESS)
+    {
+        /* TX_DISABLE_NOTIFY_CALLBACKS builds reject the callback. */
+        (void)os_wait_member_detach((os_wait_set_t *)set_handle, queue);
+        ret = OSAL_ERR_NOT_IMPLEMENTED;
+    }
+    return ret;
+}
+
+int32_t os_wait_set_add_sema_impl(osal_wait_set_handle_t set_handle, osal_sema_handle_t sema_handle)
+{
+    int32_t ret;
+    os_sema_wrapper_t *wrapper = (os_sema_wrapper_t *)sema_handle;
+    ULONG current_count;
+
+    if (tx_semaphore_info_get(&wrapper->semaphore, NULL, &current_count, NULL, NULL, NULL) != TX_SUCCESS || current_count != 0U)
+    {
+        return OSAL_ERR_INCORRECT_OBJ_STATE;
+    }
+
+    ret = os_wait_member_attach((os_wait_set_t *)set_handle, &wrapper->semaphore, false);
+    if (ret == OSAL_SUCCESS && tx_semaphore_put_notify(&wrapper->semaphore, os_wait_sema_notify) != TX_SUCCESS)
+    {
+        (void)os_wait_member_detach((os_wait_set_t *)set_handle, &wrapper->semaphore);
+        ret = OSAL_ERR_NOT_IMPLEMENTED;
+    }
+    return ret;
+}
+
+int32_t os_wait_set_remove_impl(osal_wait_set_handle_t set_handle, void *member_handle)
+{
+    int32_t ret;
+    /* os_sema_wrapper_t starts with its TX_SEMAPHORE, so the handle is the kernel object for both kinds. */
+    if (os_wait_member_detach((os_wait_set_t *)set_handle, member_handle))
+    {
+        ret = OSAL_SUCCESS;
+    }
+    else
+    {
+        ret = OSAL_ERR_INCORRECT_OBJ_STATE;
+    }
+    return ret;
+}
+
+int32_t os_wait_any_impl(osal_wait_set_handle_t set_handle, void **p_ready_handle, osal_tick_type_t timeout)
+{
+    int32_t ret;
+    UINT status;
+    ULONG msg[OS_WAIT_MSG_ULONGS];
+    os_wait_set_t *set = (os_wait_set_t *)set_handle;
+    ULONG wait_option = OS_MS_TO_TICKS(timeout);
+
+    if (OSAL_IS_IN_ISR())
+    {
+        wait_option = TX_NO_WAIT;
+    }
+
+    status = tx_queue_receive(&set->ready_queue, msg, wait_option);
+    if (status == TX_SUCCESS)
+    {
+        memcpy(p_ready_handle, msg, sizeof(void *));
+        ret = OSAL_SUCCESS;
+    }
+    else
+    {
+        ret = OSAL_ERROR_TIMEOUT;
+    }
+    return ret;
+}
+
+#endif // OSAL_RTOS_SUPPORT
@@ -0,0 +1,190 @@
+#ifndef __OSAL_INTERNAL_ATOMIC_H__
+#define __OSAL_INTERNAL_ATOMIC_H__
+
+#include "osal_internal_globaldefs.h"
+
+/*
+ * Minimal 32-bit atomics for the lock-free OSAL primitives.
+ * C11 <stdatomic.h> where the compiler has it, CMSIS exclusive access intrinsics otherwise
+ * (Arm Compiler 5 and friends). Cortex-M0 has no LDREX/STREX and falls back to PRIMASK.
+ */
+
+#if defined(__STDC_VERSION__) && (__STDC_VERSION__ >= 201112L) && !defined(__STDC_NO_ATOMICS__)
+
+#include <stdatomic.h>
+
+typedef _Atomic uint32_t osal_atomic_u32_t;
+
+static inline uint32_t osal_atomic_load_relaxed(osal_atomic_u32_t *p)
+{
+    return atomic_load_explicit(p, memory_order_relaxed);
+}
+
+static inline uint32_t osal_atomic_load_acquire(osal_atomic_u32_t *p)
+{
+    return atomic_load_explicit(p, memory_order_acquire);
+}
+
+static inline void osal_atomic_store_release(osal_atomic_u32_t *p, uint32_t value)
+{
+    atomic_store_explicit(p, value, memory_order_release);
+}
+
+static inline void osal_atomic_init(osal_atomic_u32_t *p, uint32_t value)
+{
+    atomic_init(p, value);
+}
+
+/* Full barrier, orders an earlier store against a later load. */
+static inline void osal_atomic_fence(void)
+{
+    atomic_thread_fence(memory_order_seq_cst);
+}
+
+static inline bool osal_atomic_cas(osal_atomic_u32_t *p, uint32_t *p_expected, uint32_t desired)
+{
+    return atomic_compare_exchange_weak_explicit(p, p_expected, desired, memory_order_acq_rel, memory_order_acquire);
+}
+
+static inline uint32_t osal_atomic_fetch_add(osal_atomic_u32_t *p, uint32_t value)
+{
+    return atomic_fetch_add_explicit(p, value, memory_order_acq_rel);
+}
+
+static inline uint32_t osal_atomic_exchange(osal_atomic_u32_t *p, uint32_t value)
+{
+    return atomic_exchange_explicit(p, value, memory_order_acq_rel);
+}
+
+/* Pointer-sized head for intrusive lock-free lists. */
+typedef _Atomic(void *) osal_atomic_ptr_t;
+
+static inline void *osal_atomic_ptr_load_relaxed(osal_atomic_ptr_t *p)
+{
+    return atomic_load_explicit(p, memory_order_relaxed);
+}
+
+static inline bool osal_atomic_ptr_cas(osal_atomic_ptr_t *p, void **p_expected, void *desired)
+{
+    return atomic_compare_exchange_weak_explicit(p, p_expected, desired, memory_order_acq_rel, memory_order_relaxed);
+}
+
+static inline void *osal_atomic_ptr_exchange(osal_atomic_ptr_t *p, void *value)
+{
+    return atomic_exchange_explicit(p, value, memory_order_acq_rel);
+}
+
+#else // CMSIS
+
+typedef volatile uint32_t osal_atomic_u32_t;
+
+static inline uint32_t osal_atomic_load_relaxed(osal_atomic_u32_t *p)
+{
+    return *p;
+}
+
+static inline uint32_t osal_atomic_load_acquire(osal_atomic_u32_t *p)
+{
+    uint32_t value = *p;
+    __DMB();
+    return value;
+}
+
+static inline void osal_atomic_store_release(osal_atomic_u32_t *p, uint32_t value)
+{
+    __DMB();
+    *p = value;
+}
+
+static inline void osal_atomic_init(osal_atomic_u32_t *p, uint32_t value)
+{
+    *p = value;
+}
+
+static inline void osal_atomic_fence(void)
+{
+    __DMB();
+}
+
+#if defined(__ARM_ARCH_6M__) || defined(__ARM_ARCH_8M_BASE__)
+
+static inline bool osal_atomic_cas(osal_atomic_u32_t *p, uint32_t *p_expected, uint32_t desired)
+{
+    bool ok;
+    uint32_t primask = __get_PRIMASK();
+    __disable_irq();
+    ok = (*p == *p_expected);
+    if (ok)
+    {
+        *p = desired;
+    }
+    else
+    {
+        *p_expected = *p;
+    }
+    __set_PRIMASK(primask);
+    return ok;
+}
+
+#else
+
+static inline bool osal_atomic_cas(osal_atomic_u32_t *p, uint32_t *p_expected, uint32_t desired)
+{
+    uint32_t current;
+    __DMB();
+    current = __LDREXW((volatile uint32_t *)p);
+    if (current != *p_expected)
+    {
+        __CLREX();
+        *p_expected = current;
+        return false;
+    }
+    if (__STREXW(desired, (volatile uint32_t *)p) != 0U)
+    {
+        return false;
+    }
+    __DMB();
+    return true;
+}
+
+#endif // __ARM_ARCH_6M__
+
+static inline uint32_t osal_atomic_fetch_add(osal_atomic_u32_t *p, uint32_t value)
+{
+    uint32_t old = *p;
+    while (!osal_atomic_cas(p, &old, old + value))
+    {
+    }
+    return old;
+}
+
+static inline uint32_t osal_atomic_exchange(osal_atomic_u32_t *p, uint32_t value)
+{
+    uint32_t old = *p;
+    while (!osal_atomic_cas(p, &old, value))
+    {
+    }
+    return old;
+}
+
+/* Cortex-M pointers are 32 bits wide, the pointer operations reuse the word ones. */
+typedef osal_atomic_u32_t osal_atomic_ptr_t;
+
+static inline void *osal_atomic_ptr_load_relaxed(osal_atomic_ptr_t *p)
+{
+    return (void *)osal_atomic_load_relaxed(p);
+}
+
+static inline bool osal_atomic_ptr_cas(osal_atomic_ptr_t *p, void **p_expected, void *desired)
+{
+    return osal_atomic_cas(p, (uint32_t *)p_expected, (uint32_t)desired);
+}
+
+static inline void *osal_atomic_ptr_exchange(osal_atomic_ptr_t *p, void *value)
+{
+    return (void *)osal_atomic_exchange(p, (uint32_t)value);
+}
+
+#endif // __STDC_VERSION__
+
+#endif // __OSAL_INTERNAL_ATOMIC_H__
@@ -0,0 +1,20 @@
+#ifndef __OSAL_INTERNAL_EVENT_H__
+#define __OSAL_INTERNAL_EVENT_H__
+
+#include "osal_event.h"
+#include "osal_internal_globaldefs.h"
+
+int32_t os_event_create_impl(osal_event_handle_t *p_event_handle);
+
+int32_t os_event_delete_impl(osal_event_handle_t event_handle);
+
+int32_t os_event_set_impl(osal_event_handle_t event_handle, osal_event_bits_t bits);
+
+int32_t os_event_clear_impl(osal_event_handle_t event_handle, osal_event_bits_t bits);
+
+int32_t os_event_wait_impl(osal_event_handle_t event_handle, osal_event_bits_t bits, uint32_t options,
+                           osal_event_bits_t *p_bits, osal_tick_type_t timeout);
+
+osal_event_bits_t os_event_get_impl(osal_event_handle_t event_handle);
+
+#endif // __OSAL_INTERNAL_EVENT_H__
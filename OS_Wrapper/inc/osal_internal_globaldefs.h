@@ -10,6 +10,15 @@
 
 #define OSAL_CHECK_SIZE(val) ARGCHECK((val) > 0 && (val) < (UINT32_MAX / 2), OSAL_ERR_INVALID_SIZE)
 
+#if defined(__GNUC__) || defined(__clang__)
+#define OSAL_RETURN_ADDRESS() __builtin_return_address(0)
+#else
+#define OSAL_RETURN_ADDRESS() ((void *)0)
+#endif
+
+/* Compile time check, used to size the static storage types against the kernel objects. */
+#define OSAL_STATIC_ASSERT(cond, name) typedef char osal_static_assert_##name[(cond) ? 1 : -1]
+
 #define OSAL_CHECK_STRING(str, maxlen, errcode) \
     do                                        \
     {                                         \
@@ -2,9 +2,87 @@
 #define __OSAL_INTERNAL_HEAP_H__
 
 #include "osal_heap.h"
+#include "osal_internal_globaldefs.h"
+
+/* Prepares the kernel heap, called once by osal_heap_init() and again harmlessly by a lazy path. */
+void os_heap_init_impl(void);
 
 void *os_heap_malloc_impl(size_t wanted_size);
 
+/* align is a power of two, the result is released with os_heap_free_impl(). */
+void *os_heap_malloc_aligned_impl(size_t wanted_size, size_t align);
+
 void os_heap_free_impl(void *ptr);
 
+void os_heap_get_stats_impl(osal_heap_stats_t *p_stats);
+
+/* Cheap free byte count for the pressure checks, SIZE_MAX when the heap has no fixed size. */
+size_t os_heap_get_free_impl(void);
+
+/* Backends call this when an allocation fails, wanted_size 0 when the kernel does not tell. */
+void osal_heap_report_failure(size_t wanted_size);
+
+/*
+ * Over-aligned blocks from kernel heaps without an aligned allocator. The raw block is
+ * over-allocated by OSAL_HEAP_ALIGN_OVERHEAD(align) and the two words in front of the
+ * aligned pointer hold the raw pointer and a check value, which the free path looks for.
+ * The kernel's own block headers never match: the tag has the top bit clear where a
+ * FreeRTOS allocated size has it set, and ThreadX additionally range checks the raw pointer.
+ */
+#define OSAL_HEAP_ALIGN_TAG             ((uintptr_t)0x4F53414CUL)
+#define OSAL_HEAP_ALIGN_OVERHEAD(align) ((align) + 2U * sizeof(void *))
+
+static inline void *osal_heap_align_block(void *raw, size_t align)
+{
+    uintptr_t aligned = ((uintptr_t)raw + 2U * sizeof(void *) + (align - 1U)) & ~(uintptr_t)(align - 1U);
+    ((uintptr_t *)aligned)[-1] = (uintptr_t)raw;
+    ((uintptr_t *)aligned)[-2] = (uintptr_t)raw ^ OSAL_HEAP_ALIGN_TAG;
+    return (void *)aligned;
+}
+
+/* Raw block behind an osal_heap_align_block() pointer, NULL for an ordinary block. */
+static inline void *osal_heap_align_raw(void *ptr)
+{
+    uintptr_t raw = ((uintptr_t *)ptr)[-1];
+    if ((((uintptr_t *)ptr)[-2] ^ OSAL_HEAP_ALIGN_TAG) == raw && raw < (uintptr_t)ptr)
+    {
+        return (void *)raw;
+    }
+    return NULL;
+}
+
+#if (OSAL_HEAP_CACHE_ENABLE == 1)
+/* Front end of osal_heap_malloc(), align 0 for the default alignment. */
+void *osal_heap_cache_malloc(size_t wanted_size, size_t align);
+
+void osal_heap_cache_free(void *ptr);
+
+/*
+ * Returns a task's cache to the heap, NULL is ignored. Backends call it with the task's
+ * OSAL_TASK_TLS_HEAP_CACHE slot once the thread can no longer run, not when the delete is requested.
+ */
+void osal_heap_cache_release(void *cache);
+#endif // OSAL_HEAP_CACHE_ENABLE
+
+#if (OSAL_HEAP_TRACE_ENABLE == 1)
+void *osal_heap_trace_malloc(size_t wanted_size, void *caller);
+
+void *osal_heap_trace_malloc_aligned(size_t wanted_size, size_t align, void *caller);
+
+void osal_heap_trace_free(void *ptr, void *caller);
+
+/* For allocations that bypass os_heap_malloc_impl(), such as region heaps. */
+void osal_heap_trace_note_malloc(void *ptr, size_t wanted_size, void *caller);
+
+void osal_heap_trace_note_free(void *ptr, void *caller);
+
+/* Routes every OSAL allocation through the tracer, files defining OSAL_HEAP_IMPL_SOURCE see the backend. */
+#ifndef OSAL_HEAP_IMPL_SOURCE
+#define os_heap_malloc_impl(wanted_size)    osal_heap_trace_malloc((wanted_size), OSAL_RETURN_ADDRESS())
+#define os_heap_malloc_aligned_impl(wanted_size, align) \
+    osal_heap_trace_malloc_aligned((wanted_size), (align), OSAL_RETURN_ADDRESS())
+#define os_heap_free_impl(ptr)              osal_heap_trace_free((ptr), OSAL_RETURN_ADDRESS())
+#endif
+#endif // OSAL_HEAP_TRACE_ENABLE
+
 #endif // __OSAL_INTERNAL_HEAP_H__
@@ -7,6 +7,8 @@
 
 int32_t os_mutex_create_impl(osal_mutex_handle_t *p_mutex_handle);
 
+int32_t os_mutex_create_static_impl(osal_mutex_handle_t *p_mutex_handle, void *cb_memory);
+
 void os_mutex_delete_impl(osal_mutex_handle_t mutex_handle);
 
 int32_t os_mutex_give_impl(osal_mutex_handle_t mutex_handle);
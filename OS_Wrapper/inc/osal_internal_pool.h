@@ -0,0 +1,33 @@
+#ifndef __OSAL_INTERNAL_POOL_H__
+#define __OSAL_INTERNAL_POOL_H__
+
+#include "osal_pool.h"
+#include "osal_internal_globaldefs.h"
+
+#define OSAL_POOL_ALIGN         (8U)
+
+/* The freelist links blocks by 16-bit index, the upper half of its head is an ABA tag. */
+#define OSAL_POOL_MAX_BLOCKS    (0xFFFEU)
+
+int32_t os_pool_create_impl(size_t block_size, uint32_t block_count, osal_pool_handle_t *p_pool_handle);
+
+int32_t os_pool_delete_impl(osal_pool_handle_t pool_handle);
+
+void *os_pool_alloc_impl(osal_pool_handle_t pool_handle, osal_tick_type_t timeout);
+
+int32_t os_pool_free_impl(osal_pool_handle_t pool_handle, void *block);
+
+void os_pool_get_stats_impl(osal_pool_handle_t pool_handle, osal_pool_stats_t *p_stats);
+
+/* Lock-free freelist pool shared by the backends without a native block pool. */
+int32_t osal_freelist_pool_create(size_t block_size, uint32_t block_count, osal_pool_handle_t *p_pool_handle);
+
+int32_t osal_freelist_pool_delete(osal_pool_handle_t pool_handle);
+
+void *osal_freelist_pool_alloc(osal_pool_handle_t pool_handle, osal_tick_type_t timeout);
+
+int32_t osal_freelist_pool_free(osal_pool_handle_t pool_handle, void *block);
+
+void osal_freelist_pool_get_stats(osal_pool_handle_t pool_handle, osal_pool_stats_t *p_stats);
+
+#endif // __OSAL_INTERNAL_POOL_H__
@@ -2,10 +2,13 @@
 #define __OSAL_INTERNAL_QUEUE_H__
 
 #include "osal_task.h"
+#include "osal_queue.h"
 #include "osal_internal_globaldefs.h"
 
 int32_t os_queue_create_impl( size_t queue_depth, size_t data_size,osal_queue_handle_t *p_queue_handle);
 
+int32_t os_queue_create_static_impl(size_t queue_depth, size_t data_size, void *storage, void *cb_memory, osal_queue_handle_t *p_queue_handle);
+
 void os_queue_delete_impl(osal_queue_handle_t queue_handle);
 
 int32_t os_queue_send_impl(osal_queue_handle_t queue_handle, const void *data, osal_tick_type_t timeout);
@@ -14,4 +17,8 @@ int32_t os_queue_receive_impl(osal_queue_handle_t queue_handle, void *data, osal
 
 int32_t os_queue_msg_waiting_impl(osal_queue_handle_t queue_handle);
 
+size_t os_queue_send_many_impl(osal_queue_handle_t queue_handle, const void *data, size_t data_size, size_t count, osal_tick_type_t timeout);
+
+size_t os_queue_receive_many_impl(osal_queue_handle_t queue_handle, void *data, size_t data_size, size_t count, osal_tick_type_t timeout);
+
 #endif // __OSAL_INTERNAL_QUEUE_H__
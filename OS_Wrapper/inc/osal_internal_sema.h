@@ -9,6 +9,10 @@ int32_t os_sema_countings_create_impl(osal_sema_handle_t *p_sema_handle, uint32_
 
 int32_t os_sema_binary_create_impl(osal_sema_handle_t *p_sema_handle);
 
+int32_t os_sema_countings_create_static_impl(osal_sema_handle_t *p_sema_handle, uint32_t max_count, uint32_t init_count, void *cb_memory);
+
+int32_t os_sema_binary_create_static_impl(osal_sema_handle_t *p_sema_handle, void *cb_memory);
+
 void os_sema_delete_impl(osal_sema_handle_t sema_handle);
 
 int32_t os_sema_give_impl(osal_sema_handle_t sema_handle);
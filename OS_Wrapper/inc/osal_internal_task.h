@@ -12,26 +12,41 @@ typedef struct
     osal_task_entry entry_function_pointer;
     osal_task_entry delete_hook_pointer;
     void *entry_arg;
-    osal_stackptr_t stack_pointer;
+    osal_stackptr_t stack_pointer;     // caller stack, stack_size is in bytes when set
+    void *cb_memory;                   // caller control block (osal_task_static_t), NULL to allocate
     osal_task_handle_t *p_task_handle;
+    osal_core_mask_t core_mask;        // OSAL_CORE_MASK_ANY, or a mask limited to the cores that exist
 } osal_task_internal_record_t;
 
 int32_t os_task_create_impl(osal_task_internal_record_t *p_task);
 
 void os_task_delete_impl(osal_task_handle_t task_handle);
 
+/* core_mask has been checked against os_task_core_count_impl(). */
+int32_t os_task_set_affinity_impl(osal_task_handle_t task_handle, osal_core_mask_t core_mask);
+
+uint32_t os_task_get_core_impl(void);
+
+uint32_t os_task_core_count_impl(void);
+
 void os_task_start_impl(void);
 
 void os_task_suspend_impl(osal_task_handle_t task_handle);
 
 void os_task_resume_impl(osal_task_handle_t task_handle);
 
-void os_task_suspend_all_impl(void);
+/* Nesting is counted per task, unlock fails with OSAL_ERR_INCORRECT_OBJ_STATE without a lock. */
+int32_t os_sched_lock_impl(void);
+
+int32_t os_sched_unlock_impl(void);
 
 void os_task_delay_impl(uint32_t ticks);
 
 void os_task_delay_ms_impl(uint32_t ms);
 
+/* OSAL_SUCCESS after sleeping, OSAL_ERR_DEADLINE_MISSED when the wake time had been reached. */
+int32_t os_task_delay_until_impl(osal_tick_type_t *p_last_wake, osal_tick_type_t period);
+
 uint32_t os_enter_critical_impl(void);
 
 void os_exit_critical_impl(uint32_t primask);
@@ -44,5 +59,49 @@ int32_t os_port_yield_impl(void);
 
 osal_tick_type_t os_task_get_tick_count_impl(void);
 
+/* NULL from an ISR or a thread the OSAL did not create. */
+osal_task_handle_t os_task_get_current_impl(void);
+
+/* Kernel priority of a task, NULL for the calling one. */
+osal_priority_t os_task_get_priority_impl(osal_task_handle_t task_handle);
+
+/* True when priority a is at least as urgent as b, ThreadX counts down from 0. */
+#if (OSAL_RTOS_SUPPORT == THREADX_SUPPORT)
+#define OSAL_PRIORITY_AT_LEAST(a, b)    ((a) <= (b))
+#else
+#define OSAL_PRIORITY_AT_LEAST(a, b)    ((a) >= (b))
+#endif
+
+/* Per-task pointers kept for OSAL modules, all NULL when a task is created. */
+#define OSAL_TASK_TLS_ARENA         (0U)
+#define OSAL_TASK_TLS_HEAP_CACHE    (1U)
+#if (OSAL_TASK_SWITCH_COUNT_ENABLE == 1)
+#define OSAL_TASK_TLS_SWITCHES      (2U)    // a counter, not a pointer
+#define OSAL_TASK_TLS_COUNT         (3U)
+#else
+#define OSAL_TASK_TLS_COUNT         (2U)
+#endif
+
+/*
+ * Current task only. OSAL_ERR_INCORRECT_OBJ_STATE from an ISR or a thread the OSAL did not create,
+ * OSAL_ERR_NOT_IMPLEMENTED when the kernel has no slot to spare.
+ */
+int32_t os_task_tls_set_impl(uint32_t index, void *value);
+
+void *os_task_tls_get_impl(uint32_t index);
+
+/* Fields the kernel cannot report stay 0, or OSAL_TASK_STACK_UNKNOWN for stack_free_min. */
+int32_t os_task_get_stats_impl(osal_task_handle_t task_handle, osal_task_stats_t *p_stats);
+
+size_t os_task_list_stats_impl(osal_task_stats_t *p_stats, size_t max_count, uint64_t *p_total_run_time);
+
+int32_t os_task_notify_give_impl(osal_task_handle_t task_handle);
+
+int32_t os_task_notify_take_impl(bool clear_on_exit, uint32_t *p_count, osal_tick_type_t timeout);
+
+int32_t os_task_notify_set_bits_impl(osal_task_handle_t task_handle, uint32_t bits);
+
+int32_t os_task_notify_wait_impl(uint32_t clear_on_entry, uint32_t clear_on_exit, uint32_t *p_value, osal_tick_type_t timeout);
+
 
 #endif // __OSAL_INTERNAL_TASK_H__
@@ -0,0 +1,76 @@
+#ifndef __OSAL_INTERNAL_TIME_H__
+#define __OSAL_INTERNAL_TIME_H__
+
+#include "osal_time.h"
+#include "osal_internal_globaldefs.h"
+
+osal_time_us_t os_time_now_us_impl(void);
+
+uint32_t os_time_tick_rate_hz_impl(void);
+
+/*
+ * Conversions at a tick rate known at compile time. Backends call them with their rate
+ * constant, the inlined branches fold so 1 kHz costs nothing and other rates a multiply or a
+ * division by a constant. Intermediates are wide enough for any 32-bit millisecond value.
+ */
+static inline osal_tick_type_t osal_time_ms_to_ticks_at(osal_time_ms_t ms, uint32_t hz)
+{
+    uint64_t ticks;
+
+    if (ms == (osal_time_ms_t)OSAL_MAX_DELAY)
+    {
+        return (osal_tick_type_t)OSAL_MAX_DELAY;
+    }
+    if (hz == 1000U)
+    {
+        ticks = ms;
+    }
+    else if ((hz % 1000U) == 0U)
+    {
+        ticks = (uint64_t)ms * (hz / 1000U);
+    }
+    else if ((1000U % hz) == 0U)
+    {
+        ticks = ms / (1000U / hz) + (((ms % (1000U / hz)) != 0U) ? 1U : 0U);
+    }
+    else if (ms <= (UINT32_MAX - 999U) / hz)
+    {
+        ticks = (ms * hz + 999U) / 1000U;
+    }
+    else
+    {
+        ticks = ((uint64_t)ms * hz + 999U) / 1000U;
+    }
+    return (ticks >= (uint64_t)OSAL_MAX_DELAY) ? (osal_tick_type_t)(OSAL_MAX_DELAY - 1U) : (osal_tick_type_t)ticks;
+}
+
+static inline osal_time_ms_t osal_time_ticks_to_ms_at(osal_tick_type_t ticks, uint32_t hz)
+{
+    uint64_t ms;
+
+    if (hz == 1000U)
+    {
+        return ticks;
+    }
+    if ((1000U % hz) == 0U)
+    {
+        ms = (uint64_t)ticks * (1000U / hz);
+    }
+    else
+    {
+        ms = ((uint64_t)ticks * 1000U) / hz;
+    }
+    return (ms > UINT32_MAX) ? UINT32_MAX : (osal_time_ms_t)ms;
+}
+
+/* Whole microseconds of a 64-bit tick count. */
+static inline osal_time_us_t osal_time_ticks_to_us_at(uint64_t ticks, uint32_t hz)
+{
+    if ((1000000U % hz) == 0U)
+    {
+        return ticks * (1000000U / hz);
+    }
+    return (ticks / hz) * 1000000U + ((ticks % hz) * 1000000U) / hz;
+}
+
+#endif // __OSAL_INTERNAL_TIME_H__
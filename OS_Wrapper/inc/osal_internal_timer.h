@@ -14,13 +14,25 @@ typedef struct
 typedef struct
 {
     char timer_name[configMAX_TASK_NAME_LEN];
-    osal_tick_type_t timer_period; // unit:ticks
+    osal_tick_type_t timer_period; // unit:ms, backends convert it like every other timeout
     uint8_t auto_reload;
     osal_timer_t timer_id;
+    void *cb_memory;  // kernel timer storage inside osal_timer_static_t, NULL to allocate
+    uint8_t allocated;  // record and cb_memory are one OSAL heap block, freed by os_timer_delete_impl()
 } osal_timer_internal_record_t;
 
 int32_t os_timer_create_impl(osal_timer_handle_t *timer_handle, osal_timer_internal_record_t *timer_record);
 
+/* Static timers keep the record first and the kernel object right after it. */
+#define OSAL_TIMER_STATIC_CB_SIZE   (sizeof(osal_timer_static_t) - sizeof(osal_timer_internal_record_t))
+
+/* Kernel storage osal_timer_create() places behind the record, 0 where the kernel allocates its own. */
+#if (OSAL_RTOS_SUPPORT == THREADX_SUPPORT)
+#define OSAL_TIMER_DYNAMIC_CB_SIZE  OSAL_TIMER_STATIC_CB_SIZE
+#else
+#define OSAL_TIMER_DYNAMIC_CB_SIZE  (0U)
+#endif
+
 int32_t os_timer_start_impl(osal_timer_handle_t timer_handle, osal_tick_type_t ticks_to_wait);
 
 int32_t os_timer_stop_impl(osal_timer_handle_t timer_handle, osal_tick_type_t ticks_to_wait);
@@ -0,0 +1,55 @@
+#ifndef __OSAL_INTERNAL_TLSF_H__
+#define __OSAL_INTERNAL_TLSF_H__
+
+#include "osal_internal_globaldefs.h"
+#include "osal_heap.h"
+
+/*
+ * Two-level segregated fit allocator
+ * The first level splits free blocks by power of two, the second level splits every power
+ * of two into OSAL_TLSF_SL_COUNT linear ranges. Two bitmap scans find a fitting list, so
+ * malloc and free are O(1) whatever the fragmentation. Not thread safe, callers lock.
+ */
+#define OSAL_TLSF_ALIGN             (8U)
+#define OSAL_TLSF_SL_INDEX_LOG2     (4U)
+#define OSAL_TLSF_SL_COUNT          (1U << OSAL_TLSF_SL_INDEX_LOG2)
+
+/* Blocks stay below 2^OSAL_TLSF_FL_INDEX_MAX bytes, a bigger region is only used up to that. */
+#ifndef OSAL_TLSF_FL_INDEX_MAX
+#if (OSAL_RTOS_SUPPORT == POSIX_SUPPORT)
+#define OSAL_TLSF_FL_INDEX_MAX      (30U)
+#else
+#define OSAL_TLSF_FL_INDEX_MAX      (24U)
+#endif
+#endif
+
+typedef struct osal_tlsf osal_tlsf_t;
+
+/* Places the control structure at the start of mem and hands the rest out. NULL if mem is too small. */
+osal_tlsf_t *osal_tlsf_create(void *mem, size_t bytes);
+
+void *osal_tlsf_malloc(osal_tlsf_t *tlsf, size_t size);
+
+/* align is a power of two, the block is split so that free() needs no extra bookkeeping. */
+void *osal_tlsf_memalign(osal_tlsf_t *tlsf, size_t size, size_t align);
+
+/* Pointers outside the region and blocks that are already free are ignored. */
+void osal_tlsf_free(osal_tlsf_t *tlsf, void *ptr);
+
+/* Walks the largest non-empty size class for largest_free_block, the rest is kept up to date. */
+void osal_tlsf_get_stats(osal_tlsf_t *tlsf, osal_heap_stats_t *p_stats);
+
+/* os_heap_*_impl of every backend when OSAL_HEAP_USE_TLSF is set. */
+void osal_tlsf_heap_init(void);
+
+void *osal_tlsf_heap_malloc(size_t wanted_size);
+
+void *osal_tlsf_heap_memalign(size_t wanted_size, size_t align);
+
+void osal_tlsf_heap_free(void *ptr);
+
+void osal_tlsf_heap_get_stats(osal_heap_stats_t *p_stats);
+
+size_t osal_tlsf_heap_get_free(void);
+
+#endif // __OSAL_INTERNAL_TLSF_H__
@@ -0,0 +1,19 @@
+#ifndef __OSAL_INTERNAL_WAIT_H__
+#define __OSAL_INTERNAL_WAIT_H__
+
+#include "osal_wait.h"
+#include "osal_internal_globaldefs.h"
+
+int32_t os_wait_set_create_impl(size_t max_events, osal_wait_set_handle_t *p_set_handle);
+
+int32_t os_wait_set_delete_impl(osal_wait_set_handle_t set_handle);
+
+int32_t os_wait_set_add_queue_impl(osal_wait_set_handle_t set_handle, osal_queue_handle_t queue_handle);
+
+int32_t os_wait_set_add_sema_impl(osal_wait_set_handle_t set_handle, osal_sema_handle_t sema_handle);
+
+int32_t os_wait_set_remove_impl(osal_wait_set_handle_t set_handle, void *member_handle);
+
+int32_t os_wait_any_impl(osal_wait_set_handle_t set_handle, void **p_ready_handle, osal_tick_type_t timeout);
+
+#endif // __OSAL_INTERNAL_WAIT_H__
@@ -0,0 +1,131 @@
+#include "osal_arena.h"
+#include "osal_internal_globaldefs.h"
+#include "osal_internal_heap.h"
+#include "osal_internal_task.h"
+
+//#include "app_log.h"
+
+#define OSAL_ARENA_ALIGN            (8U)
+#define OSAL_ARENA_ALIGN_UP(x, a)   (((x) + ((a) - 1U)) & ~(size_t)((a) - 1U))
+
+/* Control block and storage come from one heap block, storage right after the header. */
+typedef struct
+{
+    uint8_t *base;
+    size_t size;
+    size_t used;
+    size_t high_water;
+    uint32_t failures;
+} osal_arena_t;
+
+static osal_arena_t *osal_arena_resolve(osal_arena_handle_t arena_handle)
+{
+    if (arena_handle == NULL)
+    {
+        return (osal_arena_t *)os_task_tls_get_impl(OSAL_TASK_TLS_ARENA);
+    }
+    return (osal_arena_t *)arena_handle;
+}
+
+int32_t osal_arena_create(size_t size, osal_arena_handle_t *p_arena_handle)
+{
+    osal_arena_t *arena;
+    size_t header_size = OSAL_ARENA_ALIGN_UP(sizeof(osal_arena_t), OSAL_ARENA_ALIGN);
+
+    OSAL_CHECK_POINTER(p_arena_handle);
+    OSAL_CHECK_SIZE(size);
+
+    arena = (osal_arena_t *)os_heap_malloc_impl(header_size + size);
+    if (arena == NULL)
+    {
+        return OSAL_ERROR;
+    }
+    arena->base = (uint8_t *)arena + header_size;
+    arena->size = size;
+    arena->used = 0;
+    arena->high_water = 0;
+    arena->failures = 0;
+    *p_arena_handle = (osal_arena_handle_t)arena;
+    return OSAL_SUCCESS;
+}
+
+int32_t osal_arena_delete(osal_arena_handle_t arena_handle)
+{
+    OSAL_CHECK_POINTER(arena_handle);
+    if (os_task_tls_get_impl(OSAL_TASK_TLS_ARENA) == arena_handle)
+    {
+        (void)os_task_tls_set_impl(OSAL_TASK_TLS_ARENA, NULL);
+    }
+    os_heap_free_impl(arena_handle);
+    return OSAL_SUCCESS;
+}
+
+void *osal_arena_alloc(osal_arena_handle_t arena_handle, size_t size)
+{
+    osal_arena_t *arena = osal_arena_resolve(arena_handle);
+    size_t offset;
+
+    if (arena == NULL || size == 0U)
+    {
+        return NULL;
+    }
+    offset = OSAL_ARENA_ALIGN_UP(arena->used, OSAL_ARENA_ALIGN);
+    if (offset > arena->size || size > arena->size - offset)
+    {
+        arena->failures++;
+        return NULL;
+    }
+    arena->used = offset + size;
+    if (arena->used > arena->high_water)
+    {
+        arena->high_water = arena->used;
+    }
+    return &arena->base[offset];
+}
+
+osal_arena_mark_t osal_arena_mark(osal_arena_handle_t arena_handle)
+{
+    osal_arena_t *arena = osal_arena_resolve(arena_handle);
+    return (arena != NULL) ? arena->used : 0U;
+}
+
+int32_t osal_arena_rollback(osal_arena_handle_t arena_handle, osal_arena_mark_t mark)
+{
+    osal_arena_t *arena = osal_arena_resolve(arena_handle);
+    OSAL_CHECK_POINTER(arena);
+    ARGCHECK(mark <= arena->used, OSAL_ERR_INVALID_ARGUMENT);
+    arena->used = mark;
+    return OSAL_SUCCESS;
+}
+
+int32_t osal_arena_reset(osal_arena_handle_t arena_handle)
+{
+    osal_arena_t *arena = osal_arena_resolve(arena_handle);
+    OSAL_CHECK_POINTER(arena);
+    arena->used = 0;
+    return OSAL_SUCCESS;
+}
+
+int32_t osal_arena_get_stats(osal_arena_handle_t arena_handle, osal_arena_stats_t *p_stats)
+{
+    osal_arena_t *arena = osal_arena_resolve(arena_handle);
+    OSAL_CHECK_POINTER(arena);
+    OSAL_CHECK_POINTER(p_stats);
+    p_stats->size = arena->size;
+    p_stats->used = arena->used;
+    p_stats->high_water = arena->high_water;
+    p_stats->failures = arena->failures;
+    return OSAL_SUCCESS;
+}
+
+int32_t osal_arena_set_task_default(osal_arena_handle_t arena_handle)
+{
+    ARGCHECK(!OSAL_IS_IN_ISR(), OSAL_ERR_IN_ISR);
+    ARGCHECK(os_task_get_current_impl() != NULL, OSAL_ERR_INCORRECT_OBJ_STATE);
+    return os_task_tls_set_impl(OSAL_TASK_TLS_ARENA, arena_handle);
+}
+
+osal_arena_handle_t osal_arena_get_task_default(void)
+{
+    return (osal_arena_handle_t)os_task_tls_get_impl(OSAL_TASK_TLS_ARENA);
+}
@@ -0,0 +1,62 @@
+#include "osal_internal_event.h"
+#include "osal_internal_globaldefs.h"
+
+//#include "app_log.h"
+
+#define OSAL_CHECK_EVENT_BITS(bits) ARGCHECK(((bits) & ~OSAL_EVENT_BITS_MASK) == 0U, OSAL_ERR_INVALID_ARGUMENT)
+
+int32_t osal_event_create(osal_event_handle_t *p_event_handle)
+{
+    int32_t ret;
+    OSAL_CHECK_POINTER(p_event_handle);
+    ret = os_event_create_impl(p_event_handle);
+    return ret;
+}
+
+int32_t osal_event_delete(osal_event_handle_t event_handle)
+{
+    int32_t ret;
+    OSAL_CHECK_POINTER(event_handle);
+    ret = os_event_delete_impl(event_handle);
+    return ret;
+}
+
+int32_t osal_event_set(osal_event_handle_t event_handle, osal_event_bits_t bits)
+{
+    int32_t ret;
+    OSAL_CHECK_POINTER(event_handle);
+    OSAL_CHECK_EVENT_BITS(bits);
+    ret = os_event_set_impl(event_handle, bits);
+    return ret;
+}
+
+int32_t osal_event_clear(osal_event_handle_t event_handle, osal_event_bits_t bits)
+{
+    int32_t ret;
+    OSAL_CHECK_POINTER(event_handle);
+    OSAL_CHECK_EVENT_BITS(bits);
+    ret = os_event_clear_impl(event_handle, bits);
+    return ret;
+}
+
+int32_t osal_event_wait(osal_event_handle_t event_handle, osal_event_bits_t bits, uint32_t options,
+                        osal_event_bits_t *p_bits, osal_tick_type_t timeout)
+{
+    int32_t ret;
+    OSAL_CHECK_POINTER(event_handle);
+    OSAL_CHECK_EVENT_BITS(bits);
+    ARGCHECK(bits != 0U, OSAL_ERR_INVALID_ARGUMENT);
+    ARGCHECK((options & ~(OSAL_EVENT_WAIT_ALL | OSAL_EVENT_CLEAR_ON_EXIT)) == 0U, OSAL_ERR_INVALID_ARGUMENT);
+    ret = os_event_wait_impl(event_handle, bits, options, p_bits, timeout);
+    return ret;
+}
+
+osal_event_bits_t osal_event_get(osal_event_handle_t event_handle)
+{
+    osal_event_bits_t bits = 0;
+    if (event_handle != NULL)
+    {
+        bits = os_event_get_impl(event_handle);
+    }
+    return bits;
+}
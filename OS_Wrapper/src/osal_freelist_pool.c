@@ -0,0 +1,197 @@
+#include "osal_internal_pool.h"
+#include "osal_internal_globaldefs.h"
+#include "osal_internal_atomic.h"
+#include "osal_internal_heap.h"
+#include "osal_internal_sema.h"
+#include "osal_internal_time.h"
+
+//#include "app_log.h"
+
+/*
+ * Treiber stack of block indices. head holds the top index in its low 16 bits and a
+ * counter in the high 16 bits that changes on every push and pop, so a CAS that raced
+ * with a pop/push pair of the same block fails instead of linking a stale next.
+ * Push and pop never block, which makes both usable from interrupts.
+ */
+#define OSAL_FREELIST_EMPTY     (0xFFFFU)
+#define OSAL_FREELIST_TAG_INC   (0x10000U)
+
+#define OSAL_FREELIST_ALIGN_UP(x, a) (((uintptr_t)(x) + ((a) - 1U)) & ~(uintptr_t)((a) - 1U))
+
+typedef struct
+{
+    osal_atomic_u32_t head;
+    osal_atomic_u32_t in_use;
+    osal_atomic_u32_t high_water;
+    osal_atomic_u32_t failures;
+    osal_atomic_u32_t waiters;
+    osal_sema_handle_t free_sema;
+    uint8_t *storage;
+    uint16_t *next;
+    size_t block_size;
+    size_t stride;
+    uint32_t block_count;
+} osal_freelist_pool_t;
+
+static void *osal_freelist_pop(osal_freelist_pool_t *pool)
+{
+    uint32_t old = osal_atomic_load_acquire(&pool->head);
+    uint32_t index;
+    uint32_t desired;
+
+    do
+    {
+        index = old & OSAL_FREELIST_EMPTY;
+        if (index == OSAL_FREELIST_EMPTY)
+        {
+            return NULL;
+        }
+        desired = ((old + OSAL_FREELIST_TAG_INC) & ~(uint32_t)OSAL_FREELIST_EMPTY) | pool->next[index];
+    } while (!osal_atomic_cas(&pool->head, &old, desired));
+
+    return &pool->storage[(size_t)index * pool->stride];
+}
+
+static void osal_freelist_push(osal_freelist_pool_t *pool, uint32_t index)
+{
+    uint32_t old = osal_atomic_load_relaxed(&pool->head);
+    uint32_t desired;
+
+    do
+    {
+        pool->next[index] = (uint16_t)(old & OSAL_FREELIST_EMPTY);
+        desired = ((old + OSAL_FREELIST_TAG_INC) & ~(uint32_t)OSAL_FREELIST_EMPTY) | index;
+    } while (!osal_atomic_cas(&pool->head, &old, desired));
+}
+
+static void *osal_freelist_take(osal_freelist_pool_t *pool)
+{
+    void *block = osal_freelist_pop(pool);
+    if (block != NULL)
+    {
+        uint32_t in_use = osal_atomic_fetch_add(&pool->in_use, 1U) + 1U;
+        uint32_t high_water = osal_atomic_load_relaxed(&pool->high_water);
+        while (in_use > high_water && !osal_atomic_cas(&pool->high_water, &high_water, in_use))
+        {
+        }
+    }
+    return block;
+}
+
+int32_t osal_freelist_pool_create(size_t block_size, uint32_t block_count, osal_pool_handle_t *p_pool_handle)
+{
+    int32_t ret;
+    osal_freelist_pool_t *pool;
+    size_t ctrl_size = OSAL_FREELIST_ALIGN_UP(sizeof(osal_freelist_pool_t) + sizeof(uint16_t) * block_count, OSAL_POOL_ALIGN);
+    size_t stride = OSAL_FREELIST_ALIGN_UP(block_size, OSAL_POOL_ALIGN);
+
+    /* One block: control block, next[] links, then the blocks themselves. */
+    pool = (osal_freelist_pool_t *)os_heap_malloc_impl(ctrl_size + stride * block_count);
+    if (pool == NULL)
+    {
+        return OSAL_ERROR;
+    }
+    memset(pool, 0, sizeof(osal_freelist_pool_t));
+    pool->next = (uint16_t *)(pool + 1);
+    pool->storage = (uint8_t *)pool + ctrl_size;
+    pool->block_size = block_size;
+    pool->stride = stride;
+    pool->block_count = block_count;
+
+    for (uint32_t i = 0; i < block_count; i++)
+    {
+        pool->next[i] = (uint16_t)((i + 1U < block_count) ? (i + 1U) : OSAL_FREELIST_EMPTY);
+    }
+    osal_atomic_init(&pool->head, 0U);
+    osal_atomic_init(&pool->in_use, 0U);
+    osal_atomic_init(&pool->high_water, 0U);
+    osal_atomic_init(&pool->failures, 0U);
+    osal_atomic_init(&pool->waiters, 0U);
+
+    ret = os_sema_countings_create_impl(&pool->free_sema, block_count, 0U);
+    if (ret != OSAL_SUCCESS)
+    {
+        os_heap_free_impl(pool);
+        return ret;
+    }
+    *p_pool_handle = (osal_pool_handle_t)pool;
+    return ret;
+}
+
+int32_t osal_freelist_pool_delete(osal_pool_handle_t pool_handle)
+{
+    osal_freelist_pool_t *pool = (osal_freelist_pool_t *)pool_handle;
+    os_sema_delete_impl(pool->free_sema);
+    os_heap_free_impl(pool);
+    return OSAL_SUCCESS;
+}
+
+void *osal_freelist_pool_alloc(osal_pool_handle_t pool_handle, osal_tick_type_t timeout)
+{
+    osal_freelist_pool_t *pool = (osal_freelist_pool_t *)pool_handle;
+    void *block = osal_freelist_take(pool);
+    osal_time_us_t start_us = os_time_now_us_impl();
+    osal_tick_type_t remaining = timeout;
+
+    while (block == NULL && remaining != 0U)
+    {
+        /* Announce the wait before the last look, osal_freelist_pool_free() checks waiters after its push. */
+        osal_atomic_fetch_add(&pool->waiters, 1U);
+        osal_atomic_fence();
+        block = osal_freelist_take(pool);
+        if (block == NULL && os_sema_take_impl(pool->free_sema, remaining) != OSAL_SUCCESS)
+        {
+            remaining = 0U;
+        }
+        osal_atomic_fetch_add(&pool->waiters, (uint32_t)-1);
+        if (block == NULL)
+        {
+            block = osal_freelist_take(pool);
+        }
+        if (block == NULL && remaining != 0U && timeout != OSAL_MAX_DELAY)
+        {
+            /* Another task got the freed block first, wait only for what is left of the timeout. */
+            uint64_t elapsed_ms = (os_time_now_us_impl() - start_us) / 1000U;
+            remaining = (elapsed_ms >= timeout) ? 0U : (osal_tick_type_t)(timeout - elapsed_ms);
+        }
+    }
+
+    if (block == NULL)
+    {
+        osal_atomic_fetch_add(&pool->failures, 1U);
+    }
+    return block;
+}
+
+int32_t osal_freelist_pool_free(osal_pool_handle_t pool_handle, void *block)
+{
+    osal_freelist_pool_t *pool = (osal_freelist_pool_t *)pool_handle;
+    uintptr_t offset = (uintptr_t)block - (uintptr_t)pool->storage;
+
+    if ((uintptr_t)block < (uintptr_t)pool->storage
+        || offset >= pool->stride * pool->block_count
+        || (offset % pool->stride) != 0U)
+    {
+        return OSAL_ERR_BAD_ADDRESS;
+    }
+
+    osal_atomic_fetch_add(&pool->in_use, (uint32_t)-1);
+    osal_freelist_push(pool, (uint32_t)(offset / pool->stride));
+
+    osal_atomic_fence();
+    if (osal_atomic_load_acquire(&pool->waiters) != 0U)
+    {
+        os_sema_give_impl(pool->free_sema);
+    }
+    return OSAL_SUCCESS;
+}
+
+void osal_freelist_pool_get_stats(osal_pool_handle_t pool_handle, osal_pool_stats_t *p_stats)
+{
+    osal_freelist_pool_t *pool = (osal_freelist_pool_t *)pool_handle;
+    p_stats->block_size = pool->block_size;
+    p_stats->block_count = pool->block_count;
+    p_stats->in_use = osal_atomic_load_relaxed(&pool->in_use);
+    p_stats->high_water = osal_atomic_load_relaxed(&pool->high_water);
+    p_stats->failures = osal_atomic_load_relaxed(&pool->failures);
+}
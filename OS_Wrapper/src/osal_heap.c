@@ -1,16 +1,471 @@
 #include "osal_internal_heap.h"
 #include "osal_internal_globaldefs.h"
+#include "osal_internal_task.h"
+#include "osal_internal_tlsf.h"
+#include "osal_internal_pool.h"
+#include "osal_internal_atomic.h"
 //#include "app_log.h"
 
+/* Allocations that do not pass through os_heap_malloc_impl() are reported to the tracer here. */
+#if (OSAL_HEAP_TRACE_ENABLE == 1)
+#define OSAL_HEAP_NOTE_MALLOC(ptr, size)    osal_heap_trace_note_malloc((ptr), (size), OSAL_RETURN_ADDRESS())
+#define OSAL_HEAP_NOTE_FREE(ptr)            osal_heap_trace_note_free((ptr), OSAL_RETURN_ADDRESS())
+#else
+#define OSAL_HEAP_NOTE_MALLOC(ptr, size)
+#define OSAL_HEAP_NOTE_FREE(ptr)
+#endif
 
+typedef struct
+{
+    char name[configMAX_TASK_NAME_LEN];
+    osal_tlsf_t *tlsf;
+    uint8_t *start;
+    uint8_t *end;
+} osal_heap_region_entry_t;
+
+/* Entries are only appended, lookups read them without the lock. */
+static osal_heap_region_entry_t osal_heap_regions[OSAL_HEAP_REGION_MAX];
+static uint32_t osal_heap_region_count = 0;
+
+static osal_heap_region_entry_t *osal_heap_region_get(osal_heap_region_t region)
+{
+    if (region == OSAL_HEAP_REGION_DEFAULT || region > osal_heap_region_count)
+    {
+        return NULL;
+    }
+    return &osal_heap_regions[region - 1U];
+}
+
+/* Set up once by osal_heap_init(), tlsf stays NULL without one. */
+static osal_heap_region_entry_t osal_heap_emergency;
+
+typedef struct
+{
+    size_t threshold;
+    osal_heap_watch_cb_t cb;    // NULL for a free slot
+    void *arg;
+    bool armed;
+} osal_heap_watch_t;
+
+static osal_heap_watch_t osal_heap_watches[OSAL_HEAP_WATCH_MAX];
+static uint32_t osal_heap_watch_count = 0;
+
+static osal_heap_region_entry_t *osal_heap_region_of(const void *ptr)
+{
+    if (osal_heap_emergency.tlsf != NULL
+        && (const uint8_t *)ptr >= osal_heap_emergency.start && (const uint8_t *)ptr < osal_heap_emergency.end)
+    {
+        return &osal_heap_emergency;
+    }
+    for (uint32_t i = 0; i < osal_heap_region_count; i++)
+    {
+        if ((const uint8_t *)ptr >= osal_heap_regions[i].start && (const uint8_t *)ptr < osal_heap_regions[i].end)
+        {
+            return &osal_heap_regions[i];
+        }
+    }
+    return NULL;
+}
+
+static bool osal_heap_initialized = false;
+static osal_pool_handle_t osal_heap_isr_reserve = NULL;
+static osal_task_handle_t osal_heap_defer_task_handle = NULL;
+
+/* Blocks freed from an ISR, linked through their first word until a task releases them. */
+static osal_atomic_ptr_t osal_heap_deferred;
+
+/* Fires or re-arms the low watermarks, the lock is only taken when one changes state. */
+static void osal_heap_watch_check(void)
+{
+    size_t free_size;
+    if (osal_heap_watch_count == 0U)
+    {
+        return;
+    }
+    free_size = os_heap_get_free_impl();
+    for (uint32_t i = 0; i < OSAL_HEAP_WATCH_MAX; i++)
+    {
+        osal_heap_watch_t *watch = &osal_heap_watches[i];
+        osal_heap_watch_cb_t cb = NULL;
+        void *arg = NULL;
+        uint32_t primask;
+
+        if (watch->cb == NULL || watch->threshold == 0U || watch->armed != (free_size < watch->threshold))
+        {
+            continue;
+        }
+        primask = os_enter_critical_impl();
+        if (watch->cb != NULL && watch->armed && free_size < watch->threshold)
+        {
+            watch->armed = false;
+            cb = watch->cb;
+            arg = watch->arg;
+        }
+        else if (watch->cb != NULL && !watch->armed && free_size >= watch->threshold)
+        {
+            watch->armed = true;
+        }
+        os_exit_critical_impl(primask);
+        if (cb != NULL)
+        {
+            cb(OSAL_HEAP_EVENT_LOW, free_size, arg);
+        }
+    }
+}
+
+void osal_heap_report_failure(size_t wanted_size)
+{
+    if (osal_heap_watch_count == 0U || OSAL_IS_IN_ISR())
+    {
+        return;
+    }
+    for (uint32_t i = 0; i < OSAL_HEAP_WATCH_MAX; i++)
+    {
+        uint32_t primask = os_enter_critical_impl();
+        osal_heap_watch_cb_t cb = osal_heap_watches[i].cb;
+        void *arg = osal_heap_watches[i].arg;
+        os_exit_critical_impl(primask);
+        if (cb != NULL)
+        {
+            cb(OSAL_HEAP_EVENT_FAILED, wanted_size, arg);
+        }
+    }
+}
+
+int32_t osal_heap_watch_add(size_t threshold, osal_heap_watch_cb_t cb, void *arg)
+{
+    int32_t ret = OSAL_ERR_NO_FREE_IDS;
+    uint32_t primask;
+
+    OSAL_CHECK_POINTER(cb);
+    primask = os_enter_critical_impl();
+    for (uint32_t i = 0; i < OSAL_HEAP_WATCH_MAX; i++)
+    {
+        if (osal_heap_watches[i].cb == NULL)
+        {
+            osal_heap_watches[i].threshold = threshold;
+            osal_heap_watches[i].arg = arg;
+            osal_heap_watches[i].armed = true;
+            osal_heap_watches[i].cb = cb;
+            osal_heap_watch_count++;
+            ret = OSAL_SUCCESS;
+            break;
+        }
+    }
+    os_exit_critical_impl(primask);
+    return ret;
+}
+
+int32_t osal_heap_watch_remove(osal_heap_watch_cb_t cb, void *arg)
+{
+    int32_t ret = OSAL_ERROR;
+    uint32_t primask;
+
+    OSAL_CHECK_POINTER(cb);
+    primask = os_enter_critical_impl();
+    for (uint32_t i = 0; i < OSAL_HEAP_WATCH_MAX; i++)
+    {
+        if (osal_heap_watches[i].cb == cb && osal_heap_watches[i].arg == arg)
+        {
+            osal_heap_watches[i].cb = NULL;
+            osal_heap_watch_count--;
+            ret = OSAL_SUCCESS;
+            break;
+        }
+    }
+    os_exit_critical_impl(primask);
+    return ret;
+}
+
+static void osal_heap_drain(void)
+{
+    void *ptr;
+    if (osal_atomic_ptr_load_relaxed(&osal_heap_deferred) == NULL)
+    {
+        return;
+    }
+    ptr = osal_atomic_ptr_exchange(&osal_heap_deferred, NULL);
+    while (ptr != NULL)
+    {
+        void *next = *(void **)ptr;
+        osal_heap_free(ptr);
+        ptr = next;
+    }
+}
+
+static void osal_heap_defer_task(void *argument)
+{
+    (void)argument;
+    for (;;)
+    {
+        (void)os_task_notify_take_impl(true, NULL, OSAL_MAX_DELAY);
+        osal_heap_drain();
+    }
+}
+
+int32_t osal_heap_init(void)
+{
+    int32_t ret = OSAL_SUCCESS;
+
+    if (OSAL_IS_IN_ISR())
+    {
+        return OSAL_ERR_IN_ISR;
+    }
+    if (osal_heap_initialized)
+    {
+        return OSAL_SUCCESS;
+    }
+    os_heap_init_impl();
+#if (OSAL_HEAP_EMERGENCY_SIZE > 0)
+    {
+        void *base = os_heap_malloc_impl(OSAL_HEAP_EMERGENCY_SIZE);
+        osal_tlsf_t *tlsf = (base != NULL) ? osal_tlsf_create(base, OSAL_HEAP_EMERGENCY_SIZE) : NULL;
+        if (tlsf == NULL)
+        {
+            os_heap_free_impl(base);
+            return OSAL_ERR_INVALID_SIZE;
+        }
+        osal_heap_emergency.start = (uint8_t *)base;
+        osal_heap_emergency.end = (uint8_t *)base + OSAL_HEAP_EMERGENCY_SIZE;
+        osal_heap_emergency.tlsf = tlsf;
+    }
+#endif
+#if (OSAL_HEAP_ISR_RESERVE_COUNT > 0)
+    ret = os_pool_create_impl(OSAL_HEAP_ISR_RESERVE_SIZE, OSAL_HEAP_ISR_RESERVE_COUNT, &osal_heap_isr_reserve);
+    if (ret != OSAL_SUCCESS)
+    {
+        osal_heap_isr_reserve = NULL;
+    }
+#endif
+    if (ret == OSAL_SUCCESS)
+    {
+        ret = osal_task_create("osal_heap", osal_heap_defer_task, OSAL_HEAP_DEFER_TASK_STACK,
+                               OSAL_HEAP_DEFER_TASK_PRIORITY, &osal_heap_defer_task_handle, NULL);
+        if (ret != OSAL_SUCCESS)
+        {
+            osal_heap_defer_task_handle = NULL;
+            if (osal_heap_isr_reserve != NULL)
+            {
+                (void)os_pool_delete_impl(osal_heap_isr_reserve);
+                osal_heap_isr_reserve = NULL;
+            }
+        }
+    }
+    if (ret != OSAL_SUCCESS && osal_heap_emergency.tlsf != NULL)
+    {
+        osal_heap_emergency.tlsf = NULL;
+        os_heap_free_impl(osal_heap_emergency.start);
+    }
+    osal_heap_initialized = (ret == OSAL_SUCCESS);
+    return ret;
+}
 
 void *osal_heap_malloc(size_t wanted_size)
 {
-    void *ptr = os_heap_malloc_impl(wanted_size);
+    void *ptr;
+    if (OSAL_IS_IN_ISR())
+    {
+        if (osal_heap_isr_reserve == NULL || wanted_size > OSAL_HEAP_ISR_RESERVE_SIZE)
+        {
+            return NULL;
+        }
+        return os_pool_alloc_impl(osal_heap_isr_reserve, 0U);
+    }
+    osal_heap_drain();
+#if (OSAL_HEAP_CACHE_ENABLE == 1)
+    ptr = osal_heap_cache_malloc(wanted_size, 0U);
+    OSAL_HEAP_NOTE_MALLOC(ptr, wanted_size);
+#else
+    ptr = os_heap_malloc_impl(wanted_size);
+#endif
+    if (ptr == NULL && osal_heap_emergency.tlsf != NULL && wanted_size != 0U)
+    {
+        osal_task_handle_t self = os_task_get_current_impl();
+        if (self != NULL && OSAL_PRIORITY_AT_LEAST(os_task_get_priority_impl(self), OSAL_HEAP_EMERGENCY_PRIORITY))
+        {
+            uint32_t primask = os_enter_critical_impl();
+            ptr = osal_tlsf_malloc(osal_heap_emergency.tlsf, wanted_size);
+            os_exit_critical_impl(primask);
+            if (ptr != NULL)
+            {
+                OSAL_HEAP_NOTE_MALLOC(ptr, wanted_size);
+            }
+        }
+    }
+    osal_heap_watch_check();
     return ptr;
 }
 
 void osal_heap_free(void *ptr)
 {
-    os_heap_free_impl(ptr);
+    osal_heap_region_entry_t *entry;
+    if (ptr == NULL)
+    {
+        return;
+    }
+    if (osal_heap_isr_reserve != NULL && os_pool_free_impl(osal_heap_isr_reserve, ptr) == OSAL_SUCCESS)
+    {
+        return;
+    }
+    if (OSAL_IS_IN_ISR())
+    {
+        void *head = osal_atomic_ptr_load_relaxed(&osal_heap_deferred);
+        do
+        {
+            *(void **)ptr = head;
+        } while (!osal_atomic_ptr_cas(&osal_heap_deferred, &head, ptr));
+        if (head == NULL && osal_heap_defer_task_handle != NULL)
+        {
+            (void)os_task_notify_give_impl(osal_heap_defer_task_handle);
+        }
+        return;
+    }
+    osal_heap_drain();
+
+    entry = osal_heap_region_of(ptr);
+    if (entry != NULL)
+    {
+        OSAL_HEAP_NOTE_FREE(ptr);
+        uint32_t primask = os_enter_critical_impl();
+        osal_tlsf_free(entry->tlsf, ptr);
+        os_exit_critical_impl(primask);
+    }
+    else
+    {
+#if (OSAL_HEAP_CACHE_ENABLE == 1)
+        OSAL_HEAP_NOTE_FREE(ptr);
+        osal_heap_cache_free(ptr);
+#else
+        os_heap_free_impl(ptr);
+#endif
+    }
+    osal_heap_watch_check();
+}
+
+void *osal_heap_malloc_aligned(size_t wanted_size, size_t align)
+{
+    void *ptr;
+    if (align == 0U || (align & (align - 1U)) != 0U || OSAL_IS_IN_ISR())
+    {
+        return NULL;
+    }
+#if (OSAL_HEAP_CACHE_ENABLE == 1)
+    ptr = osal_heap_cache_malloc(wanted_size, align);
+    OSAL_HEAP_NOTE_MALLOC(ptr, wanted_size);
+#else
+    ptr = os_heap_malloc_aligned_impl(wanted_size, align);
+#endif
+    return ptr;
+}
+
+int32_t osal_heap_get_stats(osal_heap_stats_t *p_stats)
+{
+    OSAL_CHECK_POINTER(p_stats);
+    memset(p_stats, 0, sizeof(osal_heap_stats_t));
+    os_heap_get_stats_impl(p_stats);
+    return OSAL_SUCCESS;
+}
+
+int32_t osal_heap_region_add(const char *name, void *base, size_t size, osal_heap_region_t *p_region)
+{
+    int32_t ret = OSAL_SUCCESS;
+    osal_heap_region_entry_t *entry;
+    osal_tlsf_t *tlsf;
+    uint32_t primask;
+
+    OSAL_CHECK_STRING(name, configMAX_TASK_NAME_LEN, OSAL_ERR_NAME_TOO_LONG);
+    OSAL_CHECK_POINTER(base);
+    OSAL_CHECK_POINTER(p_region);
+
+    tlsf = osal_tlsf_create(base, size);
+    if (tlsf == NULL)
+    {
+        return OSAL_ERR_INVALID_SIZE;
+    }
+
+    primask = os_enter_critical_impl();
+    if (osal_heap_region_count == OSAL_HEAP_REGION_MAX)
+    {
+        ret = OSAL_ERR_NO_FREE_IDS;
+    }
+    else
+    {
+        entry = &osal_heap_regions[osal_heap_region_count];
+        memcpy(entry->name, name, strlen(name) + 1);
+        entry->tlsf = tlsf;
+        entry->start = (uint8_t *)base;
+        entry->end = (uint8_t *)base + size;
+        osal_heap_region_count++;
+        *p_region = (osal_heap_region_t)osal_heap_region_count;
+    }
+    os_exit_critical_impl(primask);
+    return ret;
+}
+
+int32_t osal_heap_region_find(const char *name, osal_heap_region_t *p_region)
+{
+    OSAL_CHECK_POINTER(name);
+    OSAL_CHECK_POINTER(p_region);
+    for (uint32_t i = 0; i < osal_heap_region_count; i++)
+    {
+        if (strncmp(osal_heap_regions[i].name, name, configMAX_TASK_NAME_LEN) == 0)
+        {
+            *p_region = (osal_heap_region_t)(i + 1U);
+            return OSAL_SUCCESS;
+        }
+    }
+    return OSAL_ERROR;
+}
+
+void *osal_heap_malloc_region(osal_heap_region_t region, size_t wanted_size)
+{
+    return osal_heap_malloc_region_aligned(region, wanted_size, 0U);
+}
+
+void *osal_heap_malloc_region_aligned(osal_heap_region_t region, size_t wanted_size, size_t align)
+{
+    osal_heap_region_entry_t *entry;
+    void *ptr;
+    uint32_t primask;
+
+    if ((align & (align - 1U)) != 0U)
+    {
+        return NULL;
+    }
+    if (region == OSAL_HEAP_REGION_DEFAULT)
+    {
+        return (align == 0U) ? osal_heap_malloc(wanted_size) : osal_heap_malloc_aligned(wanted_size, align);
+    }
+    entry = osal_heap_region_get(region);
+    if (entry == NULL)
+    {
+        return NULL;
+    }
+
+    primask = os_enter_critical_impl();
+    ptr = osal_tlsf_memalign(entry->tlsf, wanted_size, align);
+    os_exit_critical_impl(primask);
+    OSAL_HEAP_NOTE_MALLOC(ptr, wanted_size);
+    return ptr;
+}
+
+int32_t osal_heap_region_get_stats(osal_heap_region_t region, osal_heap_stats_t *p_stats)
+{
+    osal_heap_region_entry_t *entry;
+    uint32_t primask;
+
+    OSAL_CHECK_POINTER(p_stats);
+    memset(p_stats, 0, sizeof(osal_heap_stats_t));
+    if (region == OSAL_HEAP_REGION_DEFAULT)
+    {
+        os_heap_get_stats_impl(p_stats);
+        return OSAL_SUCCESS;
+    }
+    entry = osal_heap_region_get(region);
+    ARGCHECK(entry != NULL, OSAL_ERR_INVALID_ARGUMENT);
+
+    primask = os_enter_critical_impl();
+    osal_tlsf_get_stats(entry->tlsf, p_stats);
+    os_exit_critical_impl(primask);
+    return OSAL_SUCCESS;
 }
@@ -0,0 +1,293 @@
+#define OSAL_HEAP_IMPL_SOURCE
+#include "osal_internal_heap.h"
+#include "osal_internal_task.h"
+//#include "app_log.h"
+
+#if (OSAL_HEAP_CACHE_ENABLE == 1)
+
+#define OSAL_HEAP_CACHE_MIN_SIZE    (16U)
+#define OSAL_HEAP_CACHE_BATCH       (OSAL_HEAP_CACHE_DEPTH / 2U)
+#define OSAL_HEAP_CACHE_UNCACHED    (~(uintptr_t)0)
+
+/* Alignment every backend heap guarantees, larger requests go through os_heap_malloc_aligned_impl(). */
+#define OSAL_HEAP_CACHE_BASE_ALIGN  (8U)
+
+OSAL_STATIC_ASSERT(OSAL_HEAP_CACHE_CLASSES > 0 && OSAL_HEAP_CACHE_CLASSES <= 16, heap_cache_classes_range);
+OSAL_STATIC_ASSERT(OSAL_HEAP_CACHE_DEPTH > 1, heap_cache_depth_range);
+
+/* In front of every osal_heap_malloc() block, keeps the payload 8-byte aligned. */
+typedef struct
+{
+    uintptr_t size_class;   // OSAL_HEAP_CACHE_UNCACHED for blocks that bypass the cache
+    uintptr_t offset;       // from the backing heap block to the payload
+} osal_heap_cache_header_t;
+
+/* Owned by one task, reached only through its OSAL_TASK_TLS_HEAP_CACHE slot. */
+typedef struct
+{
+    void *free_list[OSAL_HEAP_CACHE_CLASSES];    // linked through the first payload word
+    uint32_t count[OSAL_HEAP_CACHE_CLASSES];
+} osal_heap_cache_t;
+
+/*
+ * Full batches parked between tasks, so blocks a consumer frees reach the producer's cache
+ * in one short critical section instead of one heap call each. Guarded by the critical section.
+ */
+static void *osal_heap_cache_depot[OSAL_HEAP_CACHE_CLASSES][OSAL_HEAP_CACHE_DEPOT];
+static uint32_t osal_heap_cache_depot_count[OSAL_HEAP_CACHE_CLASSES];
+
+static inline osal_heap_cache_header_t *osal_heap_cache_header(void *ptr)
+{
+    return (osal_heap_cache_header_t *)ptr - 1;
+}
+
+static uint32_t osal_heap_cache_class_of(size_t size)
+{
+    uint32_t size_class = 0;
+    size_t class_size = OSAL_HEAP_CACHE_MIN_SIZE;
+    while (size_class < OSAL_HEAP_CACHE_CLASSES && size > class_size)
+    {
+        size_class++;
+        class_size <<= 1;
+    }
+    return size_class;
+}
+
+static void *osal_heap_cache_block_new(uint32_t size_class)
+{
+    osal_heap_cache_header_t *header;
+    header = (osal_heap_cache_header_t *)os_heap_malloc_impl(sizeof(osal_heap_cache_header_t)
+                                                              + ((size_t)OSAL_HEAP_CACHE_MIN_SIZE << size_class));
+    if (header == NULL)
+    {
+        return NULL;
+    }
+    header->size_class = size_class;
+    header->offset = sizeof(osal_heap_cache_header_t);
+    return header + 1;
+}
+
+static void osal_heap_cache_block_release(void *ptr)
+{
+    os_heap_free_impl((uint8_t *)ptr - osal_heap_cache_header(ptr)->offset);
+}
+
+static void osal_heap_cache_trim(osal_heap_cache_t *cache, uint32_t size_class, uint32_t keep)
+{
+    while (cache->count[size_class] > keep)
+    {
+        void *ptr = cache->free_list[size_class];
+        cache->free_list[size_class] = *(void **)ptr;
+        cache->count[size_class]--;
+        osal_heap_cache_block_release(ptr);
+    }
+}
+
+/* Moves one batch from the head of the free list to the depot, or back to the heap when it is full. */
+static void osal_heap_cache_spill(osal_heap_cache_t *cache, uint32_t size_class)
+{
+    void *batch = cache->free_list[size_class];
+    void *tail = batch;
+    uint32_t primask;
+    bool parked = false;
+
+    for (uint32_t i = 1; i < OSAL_HEAP_CACHE_BATCH; i++)
+    {
+        tail = *(void **)tail;
+    }
+    cache->free_list[size_class] = *(void **)tail;
+    cache->count[size_class] -= OSAL_HEAP_CACHE_BATCH;
+    *(void **)tail = NULL;
+
+    primask = os_enter_critical_impl();
+    if (osal_heap_cache_depot_count[size_class] < OSAL_HEAP_CACHE_DEPOT)
+    {
+        osal_heap_cache_depot[size_class][osal_heap_cache_depot_count[size_class]++] = batch;
+        parked = true;
+    }
+    os_exit_critical_impl(primask);
+
+    while (!parked && batch != NULL)
+    {
+        void *ptr = batch;
+        batch = *(void **)ptr;
+        osal_heap_cache_block_release(ptr);
+    }
+}
+
+/* Fills an empty free list from the depot, or from the heap when the depot has nothing. */
+static void osal_heap_cache_refill(osal_heap_cache_t *cache, uint32_t size_class)
+{
+    void *batch = NULL;
+    uint32_t primask;
+
+    primask = os_enter_critical_impl();
+    if (osal_heap_cache_depot_count[size_class] > 0U)
+    {
+        batch = osal_heap_cache_depot[size_class][--osal_heap_cache_depot_count[size_class]];
+    }
+    os_exit_critical_impl(primask);
+
+    if (batch != NULL)
+    {
+        cache->free_list[size_class] = batch;
+        cache->count[size_class] = OSAL_HEAP_CACHE_BATCH;
+        return;
+    }
+    for (uint32_t i = 0; i < OSAL_HEAP_CACHE_BATCH; i++)
+    {
+        void *ptr = osal_heap_cache_block_new(size_class);
+        if (ptr == NULL)
+        {
+            break;
+        }
+        *(void **)ptr = cache->free_list[size_class];
+        cache->free_list[size_class] = ptr;
+        cache->count[size_class]++;
+    }
+}
+
+/* The calling task's cache, created on first use. NULL from an ISR or a foreign thread. */
+static osal_heap_cache_t *osal_heap_cache_get(void)
+{
+    osal_heap_cache_t *cache = (osal_heap_cache_t *)os_task_tls_get_impl(OSAL_TASK_TLS_HEAP_CACHE);
+
+    if (cache != NULL)
+    {
+        return cache;
+    }
+    if (os_task_get_current_impl() == NULL)
+    {
+        return NULL;
+    }
+    cache = (osal_heap_cache_t *)os_heap_malloc_impl(sizeof(osal_heap_cache_t));
+    if (cache == NULL)
+    {
+        return NULL;
+    }
+    memset(cache, 0, sizeof(osal_heap_cache_t));
+    if (os_task_tls_set_impl(OSAL_TASK_TLS_HEAP_CACHE, cache) != OSAL_SUCCESS)
+    {
+        os_heap_free_impl(cache);    // the thread has no slot, it allocates uncached
+        return NULL;
+    }
+    return cache;
+}
+
+static void *osal_heap_cache_malloc_uncached(size_t wanted_size, size_t align)
+{
+    osal_heap_cache_header_t *header;
+    uint8_t *raw;
+    size_t offset;
+
+    if (align <= OSAL_HEAP_CACHE_BASE_ALIGN)
+    {
+        offset = sizeof(osal_heap_cache_header_t);
+        raw = (wanted_size <= SIZE_MAX - offset) ? (uint8_t *)os_heap_malloc_impl(wanted_size + offset) : NULL;
+    }
+    else
+    {
+        /* The header takes a whole alignment unit so the payload keeps the alignment. */
+        offset = (align > sizeof(osal_heap_cache_header_t)) ? align : sizeof(osal_heap_cache_header_t);
+        raw = (wanted_size <= SIZE_MAX - offset) ? (uint8_t *)os_heap_malloc_aligned_impl(wanted_size + offset, offset) : NULL;
+    }
+    if (raw == NULL)
+    {
+        return NULL;
+    }
+    header = osal_heap_cache_header(raw + offset);
+    header->size_class = OSAL_HEAP_CACHE_UNCACHED;
+    header->offset = offset;
+    return raw + offset;
+}
+
+void *osal_heap_cache_malloc(size_t wanted_size, size_t align)
+{
+    uint32_t size_class = osal_heap_cache_class_of(wanted_size);
+    osal_heap_cache_t *cache;
+    void *ptr;
+
+    if (wanted_size == 0U)
+    {
+        return NULL;
+    }
+    if (size_class == OSAL_HEAP_CACHE_CLASSES || align > OSAL_HEAP_CACHE_BASE_ALIGN)
+    {
+        return osal_heap_cache_malloc_uncached(wanted_size, align);
+    }
+
+    cache = osal_heap_cache_get();
+    if (cache == NULL)
+    {
+        return osal_heap_cache_block_new(size_class);
+    }
+    if (cache->free_list[size_class] == NULL)
+    {
+        osal_heap_cache_refill(cache, size_class);
+        if (cache->free_list[size_class] == NULL)
+        {
+            return NULL;
+        }
+    }
+    ptr = cache->free_list[size_class];
+    cache->free_list[size_class] = *(void **)ptr;
+    cache->count[size_class]--;
+    return ptr;
+}
+
+void osal_heap_cache_free(void *ptr)
+{
+    uintptr_t size_class = osal_heap_cache_header(ptr)->size_class;
+    osal_heap_cache_t *cache;
+
+    if (size_class >= OSAL_HEAP_CACHE_CLASSES)
+    {
+        osal_heap_cache_block_release(ptr);
+        return;
+    }
+    /* Blocks freed by another task than the allocating one simply join the freeing task's cache. */
+    cache = osal_heap_cache_get();
+    if (cache == NULL)
+    {
+        osal_heap_cache_block_release(ptr);
+        return;
+    }
+    if (cache->count[size_class] >= OSAL_HEAP_CACHE_DEPTH)
+    {
+        osal_heap_cache_spill(cache, (uint32_t)size_class);
+    }
+    *(void **)ptr = cache->free_list[size_class];
+    cache->free_list[size_class] = ptr;
+    cache->count[size_class]++;
+}
+
+void osal_heap_cache_release(void *cache)
+{
+    osal_heap_cache_t *p_cache = (osal_heap_cache_t *)cache;
+    if (p_cache != NULL)
+    {
+        for (uint32_t i = 0; i < OSAL_HEAP_CACHE_CLASSES; i++)
+        {
+            osal_heap_cache_trim(p_cache, i, 0U);
+        }
+        os_heap_free_impl(p_cache);
+    }
+}
+
+void osal_heap_cache_flush(void)
+{
+    void *cache = os_task_tls_get_impl(OSAL_TASK_TLS_HEAP_CACHE);
+    if (cache != NULL)
+    {
+        (void)os_task_tls_set_impl(OSAL_TASK_TLS_HEAP_CACHE, NULL);
+        osal_heap_cache_release(cache);
+    }
+}
+
+#else
+
+void osal_heap_cache_flush(void)
+{
+}
+
+#endif // OSAL_HEAP_CACHE_ENABLE
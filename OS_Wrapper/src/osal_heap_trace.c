@@ -0,0 +1,242 @@
+#define OSAL_HEAP_IMPL_SOURCE
+#include "osal_internal_heap.h"
+#include "osal_internal_globaldefs.h"
+#include "osal_internal_task.h"
+
+//#include "app_log.h"
+
+#if (OSAL_HEAP_TRACE_ENABLE == 1)
+
+OSAL_STATIC_ASSERT((OSAL_HEAP_TRACE_LIVE_MAX & (OSAL_HEAP_TRACE_LIVE_MAX - 1)) == 0, heap_trace_live_max_pow2);
+
+#define OSAL_HEAP_TRACE_LIVE_MASK   ((uint32_t)OSAL_HEAP_TRACE_LIVE_MAX - 1U)
+
+/* All state below is guarded by the OSAL critical section. */
+static osal_heap_trace_record_t osal_heap_trace_log[OSAL_HEAP_TRACE_DEPTH];
+static uint32_t osal_heap_trace_log_count;
+
+/* Open addressing on the pointer, linear probing, ptr == NULL marks an empty slot. */
+static osal_heap_trace_record_t osal_heap_trace_live[OSAL_HEAP_TRACE_LIVE_MAX];
+static uint32_t osal_heap_trace_live_count;
+static uint32_t osal_heap_trace_live_dropped;
+
+static uint32_t osal_heap_trace_seq;
+
+static uint32_t osal_heap_trace_hash(const void *ptr)
+{
+    return ((uint32_t)((uintptr_t)ptr >> 3) * 2654435761U) & OSAL_HEAP_TRACE_LIVE_MASK;
+}
+
+static void osal_heap_trace_log_add(const osal_heap_trace_record_t *p_record)
+{
+    osal_heap_trace_log[osal_heap_trace_log_count % OSAL_HEAP_TRACE_DEPTH] = *p_record;
+    osal_heap_trace_log_count++;
+}
+
+static void osal_heap_trace_live_add(const osal_heap_trace_record_t *p_record)
+{
+    uint32_t i = osal_heap_trace_hash(p_record->ptr);
+
+    if (osal_heap_trace_live_count == OSAL_HEAP_TRACE_LIVE_MAX)
+    {
+        osal_heap_trace_live_dropped++;
+        return;
+    }
+    while (osal_heap_trace_live[i].ptr != NULL)
+    {
+        i = (i + 1U) & OSAL_HEAP_TRACE_LIVE_MASK;
+    }
+    osal_heap_trace_live[i] = *p_record;
+    osal_heap_trace_live_count++;
+}
+
+/* Removes ptr and returns its allocation size, 0 if it was not tracked. */
+static size_t osal_heap_trace_live_remove(const void *ptr)
+{
+    uint32_t i = osal_heap_trace_hash(ptr);
+    uint32_t j;
+    size_t size;
+
+    for (uint32_t probes = 0; osal_heap_trace_live[i].ptr != ptr; probes++)
+    {
+        if (osal_heap_trace_live[i].ptr == NULL || probes == OSAL_HEAP_TRACE_LIVE_MAX)
+        {
+            return 0;
+        }
+        i = (i + 1U) & OSAL_HEAP_TRACE_LIVE_MASK;
+    }
+    size = osal_heap_trace_live[i].size;
+    osal_heap_trace_live_count--;
+
+    /* Backward shift, pull later entries of the probe chain into the hole. */
+    j = i;
+    for (;;)
+    {
+        uint32_t home;
+        osal_heap_trace_live[i].ptr = NULL;
+        do
+        {
+            j = (j + 1U) & OSAL_HEAP_TRACE_LIVE_MASK;
+            if (osal_heap_trace_live[j].ptr == NULL)
+            {
+                return size;
+            }
+            home = osal_heap_trace_hash(osal_heap_trace_live[j].ptr);
+        } while ((i <= j) ? (i < home && home <= j) : (i < home || home <= j));
+        osal_heap_trace_live[i] = osal_heap_trace_live[j];
+        i = j;
+    }
+}
+
+void osal_heap_trace_note_malloc(void *ptr, size_t wanted_size, void *caller)
+{
+    osal_heap_trace_record_t record;
+    uint32_t primask;
+
+    record.ptr = ptr;
+    record.size = wanted_size;
+    record.caller = caller;
+    record.task = os_task_get_current_impl();
+    record.tick = os_task_get_tick_count_impl();
+    record.op = OSAL_HEAP_TRACE_MALLOC;
+
+    primask = os_enter_critical_impl();
+    record.seq = osal_heap_trace_seq++;
+    osal_heap_trace_log_add(&record);
+    if (ptr != NULL)
+    {
+        osal_heap_trace_live_add(&record);
+    }
+    os_exit_critical_impl(primask);
+}
+
+/* Call before the block is released, so a concurrent malloc cannot hand it out while it is still tracked. */
+void osal_heap_trace_note_free(void *ptr, void *caller)
+{
+    osal_heap_trace_record_t record;
+    uint32_t primask;
+
+    record.ptr = ptr;
+    record.caller = caller;
+    record.task = os_task_get_current_impl();
+    record.tick = os_task_get_tick_count_impl();
+    record.op = OSAL_HEAP_TRACE_FREE;
+
+    primask = os_enter_critical_impl();
+    record.seq = osal_heap_trace_seq++;
+    record.size = osal_heap_trace_live_remove(ptr);
+    osal_heap_trace_log_add(&record);
+    os_exit_critical_impl(primask);
+}
+
+void *osal_heap_trace_malloc(size_t wanted_size, void *caller)
+{
+    void *ptr = os_heap_malloc_impl(wanted_size);
+    osal_heap_trace_note_malloc(ptr, wanted_size, caller);
+    return ptr;
+}
+
+void *osal_heap_trace_malloc_aligned(size_t wanted_size, size_t align, void *caller)
+{
+    void *ptr = os_heap_malloc_aligned_impl(wanted_size, align);
+    osal_heap_trace_note_malloc(ptr, wanted_size, caller);
+    return ptr;
+}
+
+void osal_heap_trace_free(void *ptr, void *caller)
+{
+    if (ptr != NULL)
+    {
+        osal_heap_trace_note_free(ptr, caller);
+    }
+    os_heap_free_impl(ptr);
+}
+
+uint32_t osal_heap_trace_checkpoint(void)
+{
+    uint32_t primask = os_enter_critical_impl();
+    uint32_t seq = osal_heap_trace_seq;
+    os_exit_critical_impl(primask);
+    return seq;
+}
+
+int32_t osal_heap_trace_dump_log(osal_heap_trace_cb_t cb, void *arg)
+{
+    osal_heap_trace_record_t record;
+    uint32_t primask;
+    uint32_t count;
+    uint32_t first;
+
+    OSAL_CHECK_POINTER(cb);
+
+    primask = os_enter_critical_impl();
+    count = osal_heap_trace_log_count;
+    os_exit_critical_impl(primask);
+    first = (count > OSAL_HEAP_TRACE_DEPTH) ? (count - OSAL_HEAP_TRACE_DEPTH) : 0U;
+
+    for (uint32_t n = first; n != count; n++)
+    {
+        primask = os_enter_critical_impl();
+        if (osal_heap_trace_log_count - n > OSAL_HEAP_TRACE_DEPTH)
+        {
+            /* Overwritten since the dump started. */
+            os_exit_critical_impl(primask);
+            continue;
+        }
+        record = osal_heap_trace_log[n % OSAL_HEAP_TRACE_DEPTH];
+        os_exit_critical_impl(primask);
+        cb(&record, arg);
+    }
+    return OSAL_SUCCESS;
+}
+
+int32_t osal_heap_trace_dump_live(uint32_t from_checkpoint, uint32_t to_checkpoint, osal_heap_trace_cb_t cb, void *arg)
+{
+    osal_heap_trace_record_t record;
+    uint32_t primask;
+    uint32_t dropped;
+
+    OSAL_CHECK_POINTER(cb);
+
+    for (uint32_t i = 0; i < OSAL_HEAP_TRACE_LIVE_MAX; i++)
+    {
+        primask = os_enter_critical_impl();
+        record = osal_heap_trace_live[i];
+        os_exit_critical_impl(primask);
+        /* Wrap-safe from <= seq < to. */
+        if (record.ptr != NULL && (record.seq - from_checkpoint) < (to_checkpoint - from_checkpoint))
+        {
+            cb(&record, arg);
+        }
+    }
+
+    primask = os_enter_critical_impl();
+    dropped = osal_heap_trace_live_dropped;
+    os_exit_critical_impl(primask);
+    return (dropped != 0U) ? OSAL_ERR_NO_FREE_IDS : OSAL_SUCCESS;
+}
+
+#else
+
+uint32_t osal_heap_trace_checkpoint(void)
+{
+    return 0;
+}
+
+int32_t osal_heap_trace_dump_log(osal_heap_trace_cb_t cb, void *arg)
+{
+    (void)cb;
+    (void)arg;
+    return OSAL_ERR_NOT_IMPLEMENTED;
+}
+
+int32_t osal_heap_trace_dump_live(uint32_t from_checkpoint, uint32_t to_checkpoint, osal_heap_trace_cb_t cb, void *arg)
+{
+    (void)from_checkpoint;
+    (void)to_checkpoint;
+    (void)cb;
+    (void)arg;
+    return OSAL_ERR_NOT_IMPLEMENTED;
+}
+
+#endif // OSAL_HEAP_TRACE_ENABLE
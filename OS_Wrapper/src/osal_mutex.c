@@ -10,6 +10,15 @@ int32_t osal_mutex_create(osal_mutex_handle_t *p_mutex_handle)
     return ret;
 }
 
+int32_t osal_mutex_create_static(osal_mutex_handle_t *p_mutex_handle, osal_mutex_static_t *p_mutex_buffer)
+{
+    int32_t ret;
+    OSAL_CHECK_POINTER(p_mutex_handle);
+    OSAL_CHECK_POINTER(p_mutex_buffer);
+    ret = os_mutex_create_static_impl(p_mutex_handle, p_mutex_buffer);
+    return ret;
+}
+
 void osal_mutex_delete(osal_mutex_handle_t mutex_handle)
 {
     os_mutex_delete_impl(mutex_handle);
@@ -0,0 +1,150 @@
+#include "osal_internal_task.h"
+#include "osal_internal_time.h"
+#include "osal_internal_heap.h"
+
+//#include "app_log.h"
+
+typedef struct
+{
+    osal_periodic_cb_t cb;
+    void *arg;
+    osal_tick_type_t period;
+    volatile bool stop;             // set by osal_periodic_task_delete(), the task frees the record
+    osal_periodic_stats_t stats;    // guarded by the critical section
+} osal_periodic_t;
+
+static uint32_t osal_periodic_clamp_us(osal_time_us_t us)
+{
+    return (us > UINT32_MAX) ? UINT32_MAX : (uint32_t)us;
+}
+
+static void osal_periodic_entry(void *argument)
+{
+    osal_periodic_t *periodic = (osal_periodic_t *)argument;
+    uint32_t hz = os_time_tick_rate_hz_impl();
+    osal_tick_type_t last_wake = os_task_get_tick_count_impl();
+    osal_time_us_t anchor_us = os_time_now_us_impl();
+    uint64_t released = 0;    // periods since anchor_us
+    uint32_t primask;
+
+    while (!periodic->stop)
+    {
+        osal_time_us_t release_us = anchor_us + osal_time_ticks_to_us_at(released * periodic->period, hz);
+        osal_time_us_t start_us = os_time_now_us_impl();
+        periodic->cb(periodic->arg);
+        osal_time_us_t end_us = os_time_now_us_impl();
+
+        uint32_t exec_us = osal_periodic_clamp_us(end_us - start_us);
+        uint32_t late_us = (start_us > release_us) ? osal_periodic_clamp_us(start_us - release_us) : 0U;
+        primask = os_enter_critical_impl();
+        periodic->stats.runs++;
+        periodic->stats.exec_last_us = exec_us;
+        periodic->stats.late_last_us = late_us;
+        if (exec_us > periodic->stats.exec_max_us)
+        {
+            periodic->stats.exec_max_us = exec_us;
+        }
+        if (late_us > periodic->stats.late_max_us)
+        {
+            periodic->stats.late_max_us = late_us;
+        }
+        os_exit_critical_impl(primask);
+
+        if (periodic->stop)
+        {
+            break;
+        }
+        if (os_task_delay_until_impl(&last_wake, periodic->period) == OSAL_ERR_DEADLINE_MISSED)
+        {
+            /* Run late once and restart the grid instead of catching up in a burst. */
+            primask = os_enter_critical_impl();
+            periodic->stats.missed++;
+            os_exit_critical_impl(primask);
+            last_wake = os_task_get_tick_count_impl();
+            anchor_us = os_time_now_us_impl();
+            released = 0;
+        }
+        else
+        {
+            released++;
+        }
+    }
+
+    /* Only this task touches the record, whoever deleted it. */
+    os_heap_free_impl(periodic);
+    osal_task_delete(NULL);
+}
+
+int32_t osal_periodic_task_create(const char *task_name, osal_periodic_cb_t cb, void *arg, osal_tick_type_t period,
+                                  size_t stack_size, osal_priority_t priority, osal_periodic_handle_t *p_periodic_handle)
+{
+    int32_t ret;
+    osal_periodic_t *periodic;
+    osal_task_handle_t task;
+
+    OSAL_CHECK_POINTER(cb);
+    OSAL_CHECK_POINTER(p_periodic_handle);
+    ARGCHECK(period != 0U && period <= (osal_tick_type_t)(OSAL_MAX_DELAY / 2U), OSAL_ERR_INVALID_ARGUMENT);
+
+    periodic = (osal_periodic_t *)os_heap_malloc_impl(sizeof(osal_periodic_t));
+    if (periodic == NULL)
+    {
+        return OSAL_ERROR;
+    }
+    memset(periodic, 0, sizeof(osal_periodic_t));
+    periodic->cb = cb;
+    periodic->arg = arg;
+    periodic->period = period;
+
+    /*
+     * The handle is published before the task can run, the callback may delete itself right away.
+     * The task handle goes to a local, the record may already be freed when osal_task_create() returns.
+     */
+    *p_periodic_handle = (osal_periodic_handle_t)periodic;
+    ret = osal_task_create(task_name, osal_periodic_entry, stack_size, priority, &task, periodic);
+    if (ret != OSAL_SUCCESS)
+    {
+        *p_periodic_handle = NULL;
+        os_heap_free_impl(periodic);
+    }
+    return ret;
+}
+
+int32_t osal_periodic_task_delete(osal_periodic_handle_t periodic_handle)
+{
+    osal_periodic_t *periodic = (osal_periodic_t *)periodic_handle;
+
+    OSAL_CHECK_POINTER(periodic);
+    ARGCHECK(!OSAL_IS_IN_ISR(), OSAL_ERR_IN_ISR);
+
+    /* Never deleted from outside, the task may be in the middle of its callback or its stats update. */
+    periodic->stop = true;
+    return OSAL_SUCCESS;
+}
+
+int32_t osal_periodic_task_get_stats(osal_periodic_handle_t periodic_handle, osal_periodic_stats_t *p_stats)
+{
+    osal_periodic_t *periodic = (osal_periodic_t *)periodic_handle;
+    uint32_t primask;
+
+    OSAL_CHECK_POINTER(periodic);
+    OSAL_CHECK_POINTER(p_stats);
+
+    primask = os_enter_critical_impl();
+    *p_stats = periodic->stats;
+    os_exit_critical_impl(primask);
+    return OSAL_SUCCESS;
+}
+
+int32_t osal_periodic_task_reset_stats(osal_periodic_handle_t periodic_handle)
+{
+    osal_periodic_t *periodic = (osal_periodic_t *)periodic_handle;
+    uint32_t primask;
+
+    OSAL_CHECK_POINTER(periodic);
+
+    primask = os_enter_critical_impl();
+    memset(&periodic->stats, 0, sizeof(osal_periodic_stats_t));
+    os_exit_critical_impl(primask);
+    return OSAL_SUCCESS;
+}
@@ -0,0 +1,59 @@
+#include "osal_internal_pool.h"
+#include "osal_internal_globaldefs.h"
+
+//#include "app_log.h"
+
+int32_t osal_pool_create(size_t block_size, uint32_t block_count, osal_pool_handle_t *p_pool_handle)
+{
+    int32_t ret;
+    OSAL_CHECK_POINTER(p_pool_handle);
+    OSAL_CHECK_SIZE(block_size);
+    ARGCHECK(block_count > 0U && block_count <= OSAL_POOL_MAX_BLOCKS, OSAL_ERR_INVALID_SIZE);
+    ret = os_pool_create_impl(block_size, block_count, p_pool_handle);
+    return ret;
+}
+
+int32_t osal_pool_delete(osal_pool_handle_t pool_handle)
+{
+    int32_t ret;
+    OSAL_CHECK_POINTER(pool_handle);
+    ret = os_pool_delete_impl(pool_handle);
+    return ret;
+}
+
+void *osal_pool_alloc(osal_pool_handle_t pool_handle, osal_tick_type_t timeout)
+{
+    void *block = NULL;
+    if (pool_handle != NULL)
+    {
+        block = os_pool_alloc_impl(pool_handle, OSAL_IS_IN_ISR() ? 0U : timeout);
+    }
+    return block;
+}
+
+void *osal_pool_alloc_from_isr(osal_pool_handle_t pool_handle)
+{
+    void *block = NULL;
+    if (pool_handle != NULL)
+    {
+        block = os_pool_alloc_impl(pool_handle, 0U);
+    }
+    return block;
+}
+
+int32_t osal_pool_free(osal_pool_handle_t pool_handle, void *block)
+{
+    int32_t ret;
+    OSAL_CHECK_POINTER(pool_handle);
+    OSAL_CHECK_POINTER(block);
+    ret = os_pool_free_impl(pool_handle, block);
+    return ret;
+}
+
+int32_t osal_pool_get_stats(osal_pool_handle_t pool_handle, osal_pool_stats_t *p_stats)
+{
+    OSAL_CHECK_POINTER(pool_handle);
+    OSAL_CHECK_POINTER(p_stats);
+    os_pool_get_stats_impl(pool_handle, p_stats);
+    return OSAL_SUCCESS;
+}
@@ -1,5 +1,6 @@
 #include "osal_internal_queue.h"
 #include "osal_internal_globaldefs.h"
+#include "osal_internal_heap.h"
 // #include "osal_internal_idmap.h"
 
 //#include "app_log.h"
@@ -11,9 +12,26 @@ int32_t osal_queue_create(size_t queue_depth, size_t data_size,osal_queue_handle
     return ret;
 }
 
-void osal_queue_delete(osal_queue_handle_t queue_handle)
+int32_t osal_queue_create_static(size_t queue_depth, size_t data_size, osal_queue_handle_t *p_queue_handle,
+                                 void *storage, size_t storage_size, osal_queue_static_t *p_queue_buffer)
 {
+    int32_t ret;
+    OSAL_CHECK_POINTER(p_queue_handle);
+    OSAL_CHECK_POINTER(storage);
+    OSAL_CHECK_POINTER(p_queue_buffer);
+    OSAL_CHECK_SIZE(queue_depth);
+    OSAL_CHECK_SIZE(data_size);
+    ARGCHECK(storage_size >= OSAL_QUEUE_STORAGE_SIZE(queue_depth, data_size), OSAL_ERR_INVALID_SIZE);
+    ARGCHECK(((uintptr_t)storage & (sizeof(long) - 1U)) == 0U, OSAL_ERROR_ADDRESS_MISALIGNED);
+    ret = os_queue_create_static_impl(queue_depth, data_size, storage, p_queue_buffer, p_queue_handle);
+    return ret;
+}
+
+int32_t osal_queue_delete(osal_queue_handle_t queue_handle)
+{
+    OSAL_CHECK_POINTER(queue_handle);
     os_queue_delete_impl(queue_handle);
+    return OSAL_SUCCESS;
 }
 
 int32_t osal_queue_send(osal_queue_handle_t queue_handle, const void *data, osal_tick_type_t timeout)
@@ -30,7 +48,19 @@ int32_t osal_queue_receive(osal_queue_handle_t queue_handle, void *data, osal_ti
     return ret;
 }
 
-int32_t osal_queue_peek(osal_queue_handle_t *queue_handle)
+size_t osal_queue_send_many(osal_queue_handle_t queue_handle, const void *data, size_t data_size, size_t count, osal_tick_type_t timeout)
+{
+    size_t num = os_queue_send_many_impl(queue_handle, data, data_size, count, timeout);
+    return num;
+}
+
+size_t osal_queue_receive_many(osal_queue_handle_t queue_handle, void *data, size_t data_size, size_t count, osal_tick_type_t timeout)
+{
+    size_t num = os_queue_receive_many_impl(queue_handle, data, data_size, count, timeout);
+    return num;
+}
+
+int32_t osal_queue_peek(osal_queue_handle_t queue_handle)
 {
     int32_t ret = OSAL_SUCCESS;
     return ret;
@@ -41,3 +71,152 @@ int32_t osal_queue_msg_waiting(osal_queue_handle_t queue_handle)
     int32_t num = os_queue_msg_waiting_impl(queue_handle);
     return num;
 }
+
+/*
+ * Zero-copy queue: two kernel queues of slot pointers over one slot array.
+ * free_queue holds the slots available for loan, ready_queue the committed ones in order.
+ * Both are sized to the slot count, so commit and release never find them full.
+ */
+typedef struct
+{
+    osal_queue_handle_t free_queue;
+    osal_queue_handle_t ready_queue;
+    size_t queue_depth;
+    size_t slot_size;
+    uint8_t *storage;
+} osal_queue_loan_t;
+
+#define OSAL_QUEUE_LOAN_ALIGN   (sizeof(void *) > sizeof(uint64_t) ? sizeof(void *) : sizeof(uint64_t))
+
+static int32_t osal_queue_loan_check_slot(const osal_queue_loan_t *loan, const void *p_slot)
+{
+    uintptr_t offset = (uintptr_t)p_slot - (uintptr_t)loan->storage;
+    ARGCHECK((uintptr_t)p_slot >= (uintptr_t)loan->storage, OSAL_ERR_BAD_ADDRESS);
+    ARGCHECK(offset < loan->queue_depth * loan->slot_size, OSAL_ERR_BAD_ADDRESS);
+    ARGCHECK((offset % loan->slot_size) == 0U, OSAL_ERROR_ADDRESS_MISALIGNED);
+    return OSAL_SUCCESS;
+}
+
+int32_t osal_queue_loan_create(size_t queue_depth, size_t data_size, osal_queue_handle_t *p_queue_handle)
+{
+    int32_t ret;
+    size_t i;
+    osal_queue_loan_t *loan;
+    size_t slot_size = (data_size + OSAL_QUEUE_LOAN_ALIGN - 1U) & ~(OSAL_QUEUE_LOAN_ALIGN - 1U);
+
+    OSAL_CHECK_POINTER(p_queue_handle);
+    OSAL_CHECK_SIZE(queue_depth);
+    OSAL_CHECK_SIZE(data_size);
+
+    /* Slot storage follows the control block, which is padded to keep the first slot aligned. */
+    size_t header_size = (sizeof(osal_queue_loan_t) + OSAL_QUEUE_LOAN_ALIGN - 1U) & ~(OSAL_QUEUE_LOAN_ALIGN - 1U);
+    loan = (osal_queue_loan_t *)os_heap_malloc_impl(header_size + queue_depth * slot_size);
+    if (loan == NULL)
+    {
+        return OSAL_ERROR;
+    }
+    loan->queue_depth = queue_depth;
+    loan->slot_size = slot_size;
+    loan->storage = (uint8_t *)loan + header_size;
+
+    ret = os_queue_create_impl(queue_depth, sizeof(void *), &loan->free_queue);
+    if (ret != OSAL_SUCCESS)
+    {
+        os_heap_free_impl(loan);
+        return ret;
+    }
+    ret = os_queue_create_impl(queue_depth, sizeof(void *), &loan->ready_queue);
+    if (ret != OSAL_SUCCESS)
+    {
+        os_queue_delete_impl(loan->free_queue);
+        os_heap_free_impl(loan);
+        return ret;
+    }
+
+    for (i = 0; i < queue_depth; i++)
+    {
+        void *p_slot = &loan->storage[i * slot_size];
+        os_queue_send_impl(loan->free_queue, &p_slot, 0);
+    }
+    *p_queue_handle = (osal_queue_handle_t)loan;
+    return OSAL_SUCCESS;
+}
+
+int32_t osal_queue_loan_delete(osal_queue_handle_t queue_handle)
+{
+    osal_queue_loan_t *loan = (osal_queue_loan_t *)queue_handle;
+    OSAL_CHECK_POINTER(loan);
+
+    os_queue_delete_impl(loan->ready_queue);
+    os_queue_delete_impl(loan->free_queue);
+    os_heap_free_impl(loan);
+    return OSAL_SUCCESS;
+}
+
+int32_t osal_queue_loan(osal_queue_handle_t queue_handle, void **pp_slot, osal_tick_type_t timeout)
+{
+    int32_t ret;
+    osal_queue_loan_t *loan = (osal_queue_loan_t *)queue_handle;
+    OSAL_CHECK_POINTER(loan);
+    OSAL_CHECK_POINTER(pp_slot);
+
+    if (OSAL_IS_IN_ISR())
+    {
+        timeout = 0;
+    }
+    ret = os_queue_receive_impl(loan->free_queue, pp_slot, timeout);
+    if (ret != OSAL_SUCCESS)
+    {
+        *pp_slot = NULL;
+        ret = OSAL_QUEUE_FULL;
+    }
+    return ret;
+}
+
+int32_t osal_queue_commit(osal_queue_handle_t queue_handle, void *p_slot)
+{
+    int32_t ret;
+    osal_queue_loan_t *loan = (osal_queue_loan_t *)queue_handle;
+    OSAL_CHECK_POINTER(loan);
+
+    ret = osal_queue_loan_check_slot(loan, p_slot);
+    if (ret == OSAL_SUCCESS)
+    {
+        ret = os_queue_send_impl(loan->ready_queue, &p_slot, 0);
+    }
+    return ret;
+}
+
+int32_t osal_queue_borrow(osal_queue_handle_t queue_handle, void **pp_slot, osal_tick_type_t timeout)
+{
+    int32_t ret;
+    osal_queue_loan_t *loan = (osal_queue_loan_t *)queue_handle;
+    OSAL_CHECK_POINTER(loan);
+    OSAL_CHECK_POINTER(pp_slot);
+
+    if (OSAL_IS_IN_ISR())
+    {
+        timeout = 0;
+    }
+    ret = os_queue_receive_impl(loan->ready_queue, pp_slot, timeout);
+    if (ret != OSAL_SUCCESS)
+    {
+        *pp_slot = NULL;
+        ret = OSAL_QUEUE_EMPTY;
+    }
+    return ret;
+}
+
+int32_t osal_queue_release(osal_queue_handle_t queue_handle, void *p_slot)
+{
+    int32_t ret;
+    osal_queue_loan_t *loan = (osal_queue_loan_t *)queue_handle;
+    OSAL_CHECK_POINTER(loan);
+
+    ret = osal_queue_loan_check_slot(loan, p_slot);
+    if (ret == OSAL_SUCCESS)
+    {
+        ret = os_queue_send_impl(loan->free_queue, &p_slot, 0);
+    }
+    return ret;
+}
@@ -0,0 +1,233 @@
+#include "osal_ringbuf.h"
+#include "osal_internal_globaldefs.h"
+#include "osal_internal_atomic.h"
+#include "osal_internal_heap.h"
+#include "osal_internal_sema.h"
+#include "osal_internal_task.h"
+
+//#include "app_log.h"
+
+/*
+ * head is written by the producer only, tail by the consumer only. Both run freely and
+ * wrap at 2^32, the fill level is always head - tail. Each index sits on its own cache
+ * line so producer and consumer cores do not bounce a shared line.
+ */
+typedef struct
+{
+    void *raw;
+    uint8_t *storage;
+    uint32_t mask;
+    uint32_t elem_size;
+    uint32_t flags;
+    osal_sema_handle_t wake_sema;
+    uint8_t pad0[OSAL_CACHE_LINE_SIZE];
+
+    osal_atomic_u32_t head;
+    uint8_t pad1[OSAL_CACHE_LINE_SIZE - sizeof(osal_atomic_u32_t)];
+
+    osal_atomic_u32_t tail;
+    uint8_t pad2[OSAL_CACHE_LINE_SIZE - sizeof(osal_atomic_u32_t)];
+} osal_ringbuf_t;
+
+#define OSAL_RINGBUF_ALIGN_UP(x, a) (((uintptr_t)(x) + ((a) - 1U)) & ~(uintptr_t)((a) - 1U))
+
+int32_t osal_ringbuf_create(size_t elem_size, size_t capacity, uint32_t flags, osal_ringbuf_handle_t *p_ringbuf_handle)
+{
+    int32_t ret = OSAL_SUCCESS;
+    osal_ringbuf_t *rb;
+    void *raw;
+
+    OSAL_CHECK_POINTER(p_ringbuf_handle);
+    OSAL_CHECK_SIZE(elem_size);
+    OSAL_CHECK_SIZE(capacity);
+    ARGCHECK((capacity & (capacity - 1U)) == 0U, OSAL_ERR_INVALID_SIZE);
+    ARGCHECK(capacity <= 0x80000000UL, OSAL_ERR_INVALID_SIZE);
+
+    /* One block: line-aligned control block, then the element storage. */
+    size_t ctrl_size = OSAL_RINGBUF_ALIGN_UP(sizeof(osal_ringbuf_t), OSAL_CACHE_LINE_SIZE);
+    ARGCHECK(elem_size <= UINT32_MAX && elem_size <= (SIZE_MAX - OSAL_CACHE_LINE_SIZE - ctrl_size) / capacity, OSAL_ERR_INVALID_SIZE);
+    raw = os_heap_malloc_impl(OSAL_CACHE_LINE_SIZE + ctrl_size + elem_size * capacity);
+    if (raw == NULL)
+    {
+        return OSAL_ERROR;
+    }
+    rb = (osal_ringbuf_t *)OSAL_RINGBUF_ALIGN_UP(raw, OSAL_CACHE_LINE_SIZE);
+    memset(rb, 0, sizeof(osal_ringbuf_t));
+    rb->raw = raw;
+    rb->storage = (uint8_t *)rb + ctrl_size;
+    rb->mask = (uint32_t)(capacity - 1U);
+    rb->elem_size = (uint32_t)elem_size;
+    rb->flags = flags;
+    osal_atomic_init(&rb->head, 0U);
+    osal_atomic_init(&rb->tail, 0U);
+
+    if ((flags & OSAL_RINGBUF_WAKE_SEMA) != 0U)
+    {
+        ret = os_sema_binary_create_impl(&rb->wake_sema);
+        if (ret != OSAL_SUCCESS)
+        {
+            os_heap_free_impl(raw);
+            return ret;
+        }
+    }
+    *p_ringbuf_handle = (osal_ringbuf_handle_t)rb;
+    return ret;
+}
+
+int32_t osal_ringbuf_delete(osal_ringbuf_handle_t ringbuf_handle)
+{
+    osal_ringbuf_t *rb = (osal_ringbuf_t *)ringbuf_handle;
+    OSAL_CHECK_POINTER(rb);
+
+    if (rb->wake_sema != NULL)
+    {
+        os_sema_delete_impl(rb->wake_sema);
+    }
+    os_heap_free_impl(rb->raw);
+    return OSAL_SUCCESS;
+}
+
+static void osal_ringbuf_copy_in(osal_ringbuf_t *rb, uint32_t head, const uint8_t *src, uint32_t n)
+{
+    uint32_t offset = head & rb->mask;
+    uint32_t first = (rb->mask + 1U) - offset;
+    if (first > n)
+    {
+        first = n;
+    }
+    memcpy(&rb->storage[offset * rb->elem_size], src, (size_t)first * rb->elem_size);
+    if (n > first)
+    {
+        memcpy(rb->storage, &src[(size_t)first * rb->elem_size], (size_t)(n - first) * rb->elem_size);
+    }
+}
+
+static void osal_ringbuf_copy_out(osal_ringbuf_t *rb, uint32_t tail, uint8_t *dst, uint32_t n)
+{
+    uint32_t offset = tail & rb->mask;
+    uint32_t first = (rb->mask + 1U) - offset;
+    if (first > n)
+    {
+        first = n;
+    }
+    memcpy(dst, &rb->storage[offset * rb->elem_size], (size_t)first * rb->elem_size);
+    if (n > first)
+    {
+        memcpy(&dst[(size_t)first * rb->elem_size], rb->storage, (size_t)(n - first) * rb->elem_size);
+    }
+}
+
+size_t osal_ringbuf_write(osal_ringbuf_handle_t ringbuf_handle, const void *data, size_t count)
+{
+    osal_ringbuf_t *rb = (osal_ringbuf_t *)ringbuf_handle;
+    uint32_t primask = 0;
+    uint32_t head;
+    uint32_t space;
+    uint32_t n;
+
+    if (rb == NULL || data == NULL || count == 0U)
+    {
+        return 0;
+    }
+
+    if ((rb->flags & OSAL_RINGBUF_MPSC) != 0U)
+    {
+        primask = os_enter_critical_impl();
+    }
+
+    head = osal_atomic_load_relaxed(&rb->head);
+    space = (rb->mask + 1U) - (head - osal_atomic_load_acquire(&rb->tail));
+    n = (count < space) ? (uint32_t)count : space;
+    if (n != 0U)
+    {
+        osal_ringbuf_copy_in(rb, head, (const uint8_t *)data, n);
+        osal_atomic_store_release(&rb->head, head + n);
+    }
+
+    if ((rb->flags & OSAL_RINGBUF_MPSC) != 0U)
+    {
+        os_exit_critical_impl(primask);
+    }
+
+    /* Wake only on empty -> non-empty: the consumer had caught up with our old head. */
+    if (n != 0U && rb->wake_sema != NULL)
+    {
+        osal_atomic_fence();
+        if (osal_atomic_load_acquire(&rb->tail) == head)
+        {
+            os_sema_give_impl(rb->wake_sema);
+        }
+    }
+    return n;
+}
+
+size_t osal_ringbuf_read(osal_ringbuf_handle_t ringbuf_handle, void *data, size_t count)
+{
+    osal_ringbuf_t *rb = (osal_ringbuf_t *)ringbuf_handle;
+    uint32_t tail;
+    uint32_t used;
+    uint32_t n;
+
+    if (rb == NULL || data == NULL || count == 0U)
+    {
+        return 0;
+    }
+
+    tail = osal_atomic_load_relaxed(&rb->tail);
+    used = osal_atomic_load_acquire(&rb->head) - tail;
+    n = (count < used) ? (uint32_t)count : used;
+    if (n != 0U)
+    {
+        osal_ringbuf_copy_out(rb, tail, (uint8_t *)data, n);
+        osal_atomic_store_release(&rb->tail, tail + n);
+    }
+    return n;
+}
+
+size_t osal_ringbuf_read_wait(osal_ringbuf_handle_t ringbuf_handle, void *data, size_t count, osal_tick_type_t timeout)
+{
+    osal_ringbuf_t *rb = (osal_ringbuf_t *)ringbuf_handle;
+    size_t n;
+
+    for (;;)
+    {
+        n = osal_ringbuf_read(ringbuf_handle, data, count);
+        if (n != 0U || rb == NULL || rb->wake_sema == NULL || OSAL_IS_IN_ISR())
+        {
+            break;
+        }
+
+        /* Pairs with the fence in osal_ringbuf_write(): either we see the new head or it sees our tail. */
+        osal_atomic_fence();
+        if (osal_atomic_load_acquire(&rb->head) != osal_atomic_load_relaxed(&rb->tail))
+        {
+            continue;
+        }
+        if (os_sema_take_impl(rb->wake_sema, timeout) != OSAL_SUCCESS)
+        {
+            n = osal_ringbuf_read(ringbuf_handle, data, count);
+            break;
+        }
+    }
+    return n;
+}
+
+size_t osal_ringbuf_count(osal_ringbuf_handle_t ringbuf_handle)
+{
+    osal_ringbuf_t *rb = (osal_ringbuf_t *)ringbuf_handle;
+    if (rb == NULL)
+    {
+        return 0;
+    }
+    return osal_atomic_load_acquire(&rb->head) - osal_atomic_load_acquire(&rb->tail);
+}
+
+size_t osal_ringbuf_space(osal_ringbuf_handle_t ringbuf_handle)
+{
+    osal_ringbuf_t *rb = (osal_ringbuf_t *)ringbuf_handle;
+    if (rb == NULL)
+    {
+        return 0;
+    }
+    return (rb->mask + 1U) - (osal_atomic_load_acquire(&rb->head) - osal_atomic_load_acquire(&rb->tail));
+}
@@ -18,6 +18,25 @@ int32_t osal_sema_binary_create(osal_sema_handle_t *p_sema_handle)
     return ret;
 }
 
+int32_t osal_sema_countings_create_static(osal_sema_handle_t *p_sema_handle, uint32_t max_count, uint32_t init_count,
+                                          osal_sema_static_t *p_sema_buffer)
+{
+    int32_t ret;
+    OSAL_CHECK_POINTER(p_sema_handle);
+    OSAL_CHECK_POINTER(p_sema_buffer);
+    ret = os_sema_countings_create_static_impl(p_sema_handle, max_count, init_count, p_sema_buffer);
+    return ret;
+}
+
+int32_t osal_sema_binary_create_static(osal_sema_handle_t *p_sema_handle, osal_sema_static_t *p_sema_buffer)
+{
+    int32_t ret;
+    OSAL_CHECK_POINTER(p_sema_handle);
+    OSAL_CHECK_POINTER(p_sema_buffer);
+    ret = os_sema_binary_create_static_impl(p_sema_handle, p_sema_buffer);
+    return ret;
+}
+
 void osal_sema_delete(osal_sema_handle_t sema_handle)
 {
     os_sema_delete_impl(sema_handle);
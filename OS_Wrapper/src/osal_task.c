@@ -20,6 +20,93 @@ int32_t osal_task_create(const char *task_name, osal_task_entry func_pointer, si
     task.priority = priority;
     task.entry_function_pointer = func_pointer;
     task.entry_arg = argument;
+    task.core_mask = OSAL_CORE_MASK_ANY;
+
+    ret = os_task_create_impl(&task);
+    return ret;
+}
+
+/* The cores of core_mask that exist, 0 when none does. */
+static osal_core_mask_t osal_task_core_mask_limit(osal_core_mask_t core_mask)
+{
+    uint32_t cores = os_task_core_count_impl();
+    if (cores < 32U)
+    {
+        core_mask &= (osal_core_mask_t)((1UL << cores) - 1U);
+    }
+    return core_mask;
+}
+
+int32_t osal_task_create_affinity(const char *task_name, osal_task_entry func_pointer, size_t stack_size,
+                                  osal_priority_t priority, osal_core_mask_t core_mask,
+                                  osal_task_handle_t *p_task_handle, void *argument)
+{
+    int32_t ret;
+    osal_task_internal_record_t task;
+
+    OSAL_CHECK_POINTER(task_name);
+    OSAL_CHECK_POINTER(func_pointer);
+    OSAL_CHECK_SIZE(stack_size);
+    core_mask = osal_task_core_mask_limit(core_mask);
+    ARGCHECK(core_mask != 0U, OSAL_ERR_INVALID_ARGUMENT);
+
+    memset(&task, 0, sizeof(osal_task_internal_record_t));
+    strncpy(task.task_name, task_name, sizeof(task.task_name) - 1U);
+    task.p_task_handle = p_task_handle;
+    task.stack_size = stack_size;
+    task.priority = priority;
+    task.entry_function_pointer = func_pointer;
+    task.entry_arg = argument;
+    task.core_mask = core_mask;
+
+    ret = os_task_create_impl(&task);
+    return ret;
+}
+
+int32_t osal_task_set_affinity(osal_task_handle_t task_handle, osal_core_mask_t core_mask)
+{
+    int32_t ret;
+    ARGCHECK(!OSAL_IS_IN_ISR(), OSAL_ERR_IN_ISR);
+    core_mask = osal_task_core_mask_limit(core_mask);
+    ARGCHECK(core_mask != 0U, OSAL_ERR_INVALID_ARGUMENT);
+    ret = os_task_set_affinity_impl(task_handle, core_mask);
+    return ret;
+}
+
+uint32_t osal_task_get_core(void)
+{
+    return os_task_get_core_impl();
+}
+
+uint32_t osal_task_core_count(void)
+{
+    return os_task_core_count_impl();
+}
+
+int32_t osal_task_create_static(const char *task_name, osal_task_entry func_pointer, size_t stack_size,
+                                osal_priority_t priority, osal_task_handle_t *p_task_handle, void *argument,
+                                void *stack_buffer, osal_task_static_t *p_task_buffer)
+{
+    int32_t ret;
+    osal_task_internal_record_t task;
+
+    OSAL_CHECK_POINTER(task_name);
+    OSAL_CHECK_POINTER(func_pointer);
+    OSAL_CHECK_POINTER(stack_buffer);
+    OSAL_CHECK_POINTER(p_task_buffer);
+    OSAL_CHECK_SIZE(stack_size);
+    ARGCHECK(((uintptr_t)stack_buffer & (OSAL_TASK_STACK_ALIGNMENT - 1U)) == 0U, OSAL_ERROR_ADDRESS_MISALIGNED);
+
+    memset(&task, 0, sizeof(osal_task_internal_record_t));
+    strncpy(task.task_name, task_name, sizeof(task.task_name) - 1U);
+    task.p_task_handle = p_task_handle;
+    task.stack_size = stack_size;
+    task.priority = priority;
+    task.entry_function_pointer = func_pointer;
+    task.entry_arg = argument;
+    task.stack_pointer = (osal_stackptr_t)stack_buffer;
+    task.cb_memory = p_task_buffer;
+    task.core_mask = OSAL_CORE_MASK_ANY;
 
     ret = os_task_create_impl(&task);
     return ret;
@@ -27,6 +114,14 @@ int32_t osal_task_create(const char *task_name, osal_task_entry func_pointer, si
 
 void osal_task_delete(osal_task_handle_t osal_task_handle)
 {
+    /*
+     * Deleting the calling task does not return, hand its cache back first. The cache of another
+     * task is released by the backend once that task has really stopped.
+     */
+    if (osal_task_handle == NULL || osal_task_handle == os_task_get_current_impl())
+    {
+        osal_heap_cache_flush();
+    }
     os_task_delete_impl(osal_task_handle);
 }
 
@@ -40,9 +135,30 @@ void osal_task_suspend(osal_task_handle_t osal_task_handle)
     os_task_suspend_impl(osal_task_handle);
 }
 
+int32_t osal_sched_lock(void)
+{
+    int32_t ret;
+    ARGCHECK(!OSAL_IS_IN_ISR(), OSAL_ERR_IN_ISR);
+    ret = os_sched_lock_impl();
+    return ret;
+}
+
+int32_t osal_sched_unlock(void)
+{
+    int32_t ret;
+    ARGCHECK(!OSAL_IS_IN_ISR(), OSAL_ERR_IN_ISR);
+    ret = os_sched_unlock_impl();
+    return ret;
+}
+
 void osal_task_suspend_all(void)
 {
-    os_task_suspend_all_impl();
+    (void)osal_sched_lock();
+}
+
+void osal_task_resume_all(void)
+{
+    (void)osal_sched_unlock();
 }
 
 void osal_task_resume(osal_task_handle_t osal_task_handle)
@@ -60,6 +176,16 @@ void osal_task_delay_ms(uint32_t ms)
     os_task_delay_ms_impl(ms);
 }
 
+int32_t osal_task_delay_until(osal_tick_type_t *p_last_wake, osal_tick_type_t period)
+{
+    int32_t ret;
+    OSAL_CHECK_POINTER(p_last_wake);
+    ARGCHECK(period != 0U && period <= (osal_tick_type_t)(OSAL_MAX_DELAY / 2U), OSAL_ERR_INVALID_ARGUMENT);
+    ARGCHECK(!OSAL_IS_IN_ISR(), OSAL_ERR_IN_ISR);
+    ret = os_task_delay_until_impl(p_last_wake, period);
+    return ret;
+}
+
 uint32_t osal_enter_critical(void)
 {
     return os_enter_critical_impl();
@@ -91,3 +217,33 @@ osal_tick_type_t osal_task_get_tick_count(void)
     osal_tick_type_t osal_ticks = os_task_get_tick_count_impl();
     return osal_ticks;
 }
+
+int32_t osal_task_notify_give(osal_task_handle_t task_handle)
+{
+    int32_t ret;
+    OSAL_CHECK_POINTER(task_handle);
+    ret = os_task_notify_give_impl(task_handle);
+    return ret;
+}
+
+int32_t osal_task_notify_take(bool clear_on_exit, uint32_t *p_count, osal_tick_type_t timeout)
+{
+    int32_t ret;
+    ret = os_task_notify_take_impl(clear_on_exit, p_count, timeout);
+    return ret;
+}
+
+int32_t osal_task_notify_set_bits(osal_task_handle_t task_handle, uint32_t bits)
+{
+    int32_t ret;
+    OSAL_CHECK_POINTER(task_handle);
+    ret = os_task_notify_set_bits_impl(task_handle, bits);
+    return ret;
+}
+
+int32_t osal_task_notify_wait(uint32_t clear_on_entry, uint32_t clear_on_exit, uint32_t *p_value, osal_tick_type_t timeout)
+{
+    int32_t ret;
+    ret = os_task_notify_wait_impl(clear_on_entry, clear_on_exit, p_value, timeout);
+    return ret;
+}
@@ -0,0 +1,79 @@
+#include "osal_internal_task.h"
+#include "osal_internal_time.h"
+#include "osal_internal_globaldefs.h"
+
+//#include "app_log.h"
+
+#if (OSAL_RTOS_SUPPORT != POSIX_SUPPORT) && \
+    (defined(__ARM_ARCH_7M__) || defined(__ARM_ARCH_7EM__) || defined(__ARM_ARCH_8M_MAIN__) || defined(__ARM_ARCH_8_1M_MAIN__))
+#define OSAL_TASK_STATS_DWT (1)
+
+#define OSAL_DWT_CTRL       (*(volatile uint32_t *)0xE0001000UL)
+#define OSAL_DWT_CYCCNT     (*(volatile uint32_t *)0xE0001004UL)
+#define OSAL_DEM_CR         (*(volatile uint32_t *)0xE000EDFCUL)
+#define OSAL_DEM_CR_TRCENA  (1UL << 24)
+#define OSAL_DWT_CTRL_CYCCNTENA (1UL << 0)
+
+/* CYCCNT is 32 bits wide, wraps are counted here, which needs a read at least once per wrap. */
+static uint32_t osal_task_stats_last;
+static uint32_t osal_task_stats_wraps;
+#endif
+
+void osal_task_stats_counter_init(void)
+{
+#if defined(OSAL_TASK_STATS_DWT)
+    OSAL_DEM_CR |= OSAL_DEM_CR_TRCENA;
+    OSAL_DWT_CYCCNT = 0U;
+    OSAL_DWT_CTRL |= OSAL_DWT_CTRL_CYCCNTENA;
+    osal_task_stats_last = 0U;
+    osal_task_stats_wraps = 0U;
+#endif
+}
+
+uint64_t osal_task_stats_counter(void)
+{
+#if defined(OSAL_TASK_STATS_DWT)
+    /* PRIMASK rather than the OSAL critical section, the kernels call this while switching context. */
+    uint32_t primask = __get_PRIMASK();
+    __disable_irq();
+    uint32_t now = OSAL_DWT_CYCCNT;
+    if (now < osal_task_stats_last)
+    {
+        osal_task_stats_wraps++;
+    }
+    osal_task_stats_last = now;
+    uint64_t count = ((uint64_t)osal_task_stats_wraps << 32) | now;
+    __set_PRIMASK(primask);
+    return count;
+#else
+    return os_time_now_us_impl();
+#endif
+}
+
+int32_t osal_task_get_stats(osal_task_handle_t task_handle, osal_task_stats_t *p_stats)
+{
+    OSAL_CHECK_POINTER(p_stats);
+    ARGCHECK(!OSAL_IS_IN_ISR(), OSAL_ERR_IN_ISR);
+
+    if (task_handle == NULL)
+    {
+        task_handle = os_task_get_current_impl();
+    }
+    memset(p_stats, 0, sizeof(osal_task_stats_t));
+    return os_task_get_stats_impl(task_handle, p_stats);
+}
+
+size_t osal_task_list_stats(osal_task_stats_t *p_stats, size_t max_count, uint64_t *p_total_run_time)
+{
+    if (p_total_run_time != NULL)
+    {
+        *p_total_run_time = 0U;
+    }
+    if (p_stats == NULL || max_count == 0U || OSAL_IS_IN_ISR())
+    {
+        return 0U;
+    }
+
+    memset(p_stats, 0, max_count * sizeof(osal_task_stats_t));
+    return os_task_list_stats_impl(p_stats, max_count, p_total_run_time);
+}
@@ -0,0 +1,24 @@
+#include "osal_internal_time.h"
+#include "osal_internal_globaldefs.h"
+
+//#include "app_log.h"
+
+osal_time_us_t osal_time_now_us(void)
+{
+    return os_time_now_us_impl();
+}
+
+uint32_t osal_time_tick_rate_hz(void)
+{
+    return os_time_tick_rate_hz_impl();
+}
+
+osal_tick_type_t osal_time_ms_to_ticks(osal_time_ms_t ms)
+{
+    return osal_time_ms_to_ticks_at(ms, os_time_tick_rate_hz_impl());
+}
+
+osal_time_ms_t osal_time_ticks_to_ms(osal_tick_type_t ticks)
+{
+    return osal_time_ticks_to_ms_at(ticks, os_time_tick_rate_hz_impl());
+}
@@ -8,13 +8,56 @@ int32_t osal_timer_create(osal_timer_handle_t *p_timer_handle, const char *timer
 {
     int32_t ret;
     osal_timer_internal_record_t *p_timer_record;
-    p_timer_record = os_heap_malloc_impl(sizeof(osal_timer_internal_record_t));
 
+    OSAL_CHECK_POINTER(p_timer_handle);
+    OSAL_CHECK_STRING(timer_name, configMAX_TASK_NAME_LEN, OSAL_ERR_NAME_TOO_LONG);
+
+    /* Owned by the backend from here on, released by os_timer_delete_impl(). */
+    if (OSAL_TIMER_DYNAMIC_CB_SIZE != 0U)
+    {
+        p_timer_record = os_heap_malloc_aligned_impl(sizeof(osal_timer_internal_record_t) + OSAL_TIMER_DYNAMIC_CB_SIZE, OSAL_CACHE_LINE_SIZE);
+    }
+    else
+    {
+        p_timer_record = os_heap_malloc_impl(sizeof(osal_timer_internal_record_t));
+    }
+    if (p_timer_record == NULL)
+    {
+        return OSAL_ERROR;
+    }
+
+    memcpy(p_timer_record->timer_name, timer_name, strlen(timer_name) + 1);
+    p_timer_record->timer_period = timer_period;
+    p_timer_record->auto_reload = auto_reload;
+    p_timer_record->timer_id.func = timer_cb;
+    p_timer_record->timer_id.arg = arg;
+    p_timer_record->cb_memory = (OSAL_TIMER_DYNAMIC_CB_SIZE != 0U) ? (void *)(p_timer_record + 1) : NULL;
+    p_timer_record->allocated = 1U;
+    ret = os_timer_create_impl(p_timer_handle, p_timer_record);
+    if (ret != OSAL_SUCCESS)
+    {
+        os_heap_free_impl(p_timer_record);
+    }
+    return ret;
+}
+
+int32_t osal_timer_create_static(osal_timer_handle_t *p_timer_handle, const char *timer_name, osal_tick_type_t timer_period, uint8_t auto_reload, osal_timer_cb_function_t timer_cb, void *arg,
+                                 osal_timer_static_t *p_timer_buffer)
+{
+    int32_t ret;
+    osal_timer_internal_record_t *p_timer_record = (osal_timer_internal_record_t *)p_timer_buffer;
+
+    OSAL_CHECK_POINTER(p_timer_handle);
+    OSAL_CHECK_POINTER(p_timer_buffer);
+    OSAL_CHECK_STRING(timer_name, configMAX_TASK_NAME_LEN, OSAL_ERR_NAME_TOO_LONG);
+
+    memset(p_timer_record, 0, sizeof(osal_timer_internal_record_t));
     memcpy(p_timer_record->timer_name, timer_name, strlen(timer_name) + 1);
     p_timer_record->timer_period = timer_period;
     p_timer_record->auto_reload = auto_reload;
     p_timer_record->timer_id.func = timer_cb;
     p_timer_record->timer_id.arg = arg;
+    p_timer_record->cb_memory = (void *)(p_timer_record + 1);
     ret = os_timer_create_impl(p_timer_handle, p_timer_record);
     return ret;
 }
@@ -0,0 +1,511 @@
+#include "osal_internal_tlsf.h"
+#include "osal_internal_heap.h"
+#include "osal_internal_task.h"
+
+//#include "app_log.h"
+
+#define OSAL_TLSF_ALIGN_LOG2        (3U)
+#define OSAL_TLSF_FL_INDEX_SHIFT    (OSAL_TLSF_SL_INDEX_LOG2 + OSAL_TLSF_ALIGN_LOG2)
+#define OSAL_TLSF_FL_COUNT          (OSAL_TLSF_FL_INDEX_MAX - OSAL_TLSF_FL_INDEX_SHIFT + 1U)
+#define OSAL_TLSF_SMALL_BLOCK_SIZE  (1UL << OSAL_TLSF_FL_INDEX_SHIFT)
+#define OSAL_TLSF_BLOCK_SIZE_MAX    (((size_t)1U << OSAL_TLSF_FL_INDEX_MAX) - OSAL_TLSF_ALIGN)
+
+OSAL_STATIC_ASSERT(OSAL_TLSF_FL_INDEX_MAX < 32U, osal_tlsf_fl_index_fits_bitmap);
+
+#define OSAL_TLSF_ALIGN_UP(x, a)    (((uintptr_t)(x) + ((a) - 1U)) & ~(uintptr_t)((a) - 1U))
+#define OSAL_TLSF_ALIGN_DOWN(x, a)  ((uintptr_t)(x) & ~(uintptr_t)((a) - 1U))
+
+/*
+ * Every block starts with a two word header: its physical predecessor and its payload size.
+ * The low bit of size marks a free block, free blocks keep their list links in the payload.
+ * Headers are a multiple of 8 bytes, so payloads stay 8-byte aligned on 32 and 64-bit.
+ * A zero sized used block at the end of the region stops the merge with the next block.
+ */
+typedef struct osal_tlsf_block
+{
+    struct osal_tlsf_block *prev_phys;
+    size_t size;
+    struct osal_tlsf_block *next_free;
+    struct osal_tlsf_block *prev_free;
+} osal_tlsf_block_t;
+
+#define OSAL_TLSF_BLOCK_FREE        ((size_t)1U)
+#define OSAL_TLSF_HEADER_SIZE       OSAL_TLSF_ALIGN_UP(offsetof(osal_tlsf_block_t, next_free), OSAL_TLSF_ALIGN)
+#define OSAL_TLSF_PAYLOAD_MIN       OSAL_TLSF_ALIGN_UP(sizeof(osal_tlsf_block_t) - offsetof(osal_tlsf_block_t, next_free), OSAL_TLSF_ALIGN)
+
+struct osal_tlsf
+{
+    uint32_t fl_bitmap;
+    uint32_t sl_bitmap[OSAL_TLSF_FL_COUNT];
+    osal_tlsf_block_t *free_lists[OSAL_TLSF_FL_COUNT][OSAL_TLSF_SL_COUNT];
+    uint8_t *region_start;
+    uint8_t *region_end;
+    size_t total_size;
+    size_t free_size;
+    size_t min_free_size;
+    uint32_t free_blocks;
+    uint32_t alloc_count;
+    uint32_t free_count;
+    uint32_t failed_count;
+};
+
+static inline uint32_t osal_tlsf_fls(size_t value)
+{
+#if defined(__GNUC__) || defined(__clang__)
+    return (uint32_t)(31 - __builtin_clz((uint32_t)value));
+#else
+    uint32_t bit = 0;
+    while ((value >>= 1) != 0U)
+    {
+        bit++;
+    }
+    return bit;
+#endif
+}
+
+static inline uint32_t osal_tlsf_ffs(uint32_t value)
+{
+#if defined(__GNUC__) || defined(__clang__)
+    return (uint32_t)__builtin_ctz(value);
+#else
+    return osal_tlsf_fls(value & (~value + 1U));
+#endif
+}
+
+static inline size_t osal_tlsf_block_size(const osal_tlsf_block_t *block)
+{
+    return block->size & ~OSAL_TLSF_BLOCK_FREE;
+}
+
+static inline bool osal_tlsf_block_is_free(const osal_tlsf_block_t *block)
+{
+    return (block->size & OSAL_TLSF_BLOCK_FREE) != 0U;
+}
+
+static inline osal_tlsf_block_t *osal_tlsf_block_next(const osal_tlsf_block_t *block)
+{
+    return (osal_tlsf_block_t *)((uint8_t *)block + OSAL_TLSF_HEADER_SIZE + osal_tlsf_block_size(block));
+}
+
+static inline void *osal_tlsf_block_to_ptr(osal_tlsf_block_t *block)
+{
+    return (uint8_t *)block + OSAL_TLSF_HEADER_SIZE;
+}
+
+static inline osal_tlsf_block_t *osal_tlsf_block_from_ptr(void *ptr)
+{
+    return (osal_tlsf_block_t *)((uint8_t *)ptr - OSAL_TLSF_HEADER_SIZE);
+}
+
+static void osal_tlsf_mapping_insert(size_t size, uint32_t *p_fl, uint32_t *p_sl)
+{
+    uint32_t fl;
+    uint32_t sl;
+    if (size < OSAL_TLSF_SMALL_BLOCK_SIZE)
+    {
+        fl = 0;
+        sl = (uint32_t)(size / (OSAL_TLSF_SMALL_BLOCK_SIZE / OSAL_TLSF_SL_COUNT));
+    }
+    else
+    {
+        fl = osal_tlsf_fls(size);
+        sl = (uint32_t)(size >> (fl - OSAL_TLSF_SL_INDEX_LOG2)) ^ OSAL_TLSF_SL_COUNT;
+        fl -= (OSAL_TLSF_FL_INDEX_SHIFT - 1U);
+    }
+    *p_fl = fl;
+    *p_sl = sl;
+}
+
+/* Rounds the request up to the next list boundary, any block of that list then fits. */
+static void osal_tlsf_mapping_search(size_t size, uint32_t *p_fl, uint32_t *p_sl)
+{
+    if (size >= OSAL_TLSF_SMALL_BLOCK_SIZE)
+    {
+        size += ((size_t)1U << (osal_tlsf_fls(size) - OSAL_TLSF_SL_INDEX_LOG2)) - 1U;
+    }
+    osal_tlsf_mapping_insert(size, p_fl, p_sl);
+}
+
+static osal_tlsf_block_t *osal_tlsf_search_suitable(osal_tlsf_t *tlsf, uint32_t *p_fl, uint32_t *p_sl)
+{
+    uint32_t fl = *p_fl;
+    uint32_t sl_map;
+
+    if (fl >= OSAL_TLSF_FL_COUNT)
+    {
+        return NULL;
+    }
+    sl_map = tlsf->sl_bitmap[fl] & (~0U << *p_sl);
+    if (sl_map == 0U)
+    {
+        uint32_t fl_map = (fl + 1U < 32U) ? (tlsf->fl_bitmap & (~0U << (fl + 1U))) : 0U;
+        if (fl_map == 0U)
+        {
+            return NULL;
+        }
+        fl = osal_tlsf_ffs(fl_map);
+        sl_map = tlsf->sl_bitmap[fl];
+    }
+    *p_fl = fl;
+    *p_sl = osal_tlsf_ffs(sl_map);
+    return tlsf->free_lists[fl][*p_sl];
+}
+
+static void osal_tlsf_remove_free(osal_tlsf_t *tlsf, osal_tlsf_block_t *block, uint32_t fl, uint32_t sl)
+{
+    osal_tlsf_block_t *prev = block->prev_free;
+    osal_tlsf_block_t *next = block->next_free;
+
+    tlsf->free_size -= osal_tlsf_block_size(block);
+    tlsf->free_blocks--;
+
+    if (next != NULL)
+    {
+        next->prev_free = prev;
+    }
+    if (prev != NULL)
+    {
+        prev->next_free = next;
+    }
+    else
+    {
+        tlsf->free_lists[fl][sl] = next;
+        if (next == NULL)
+        {
+            tlsf->sl_bitmap[fl] &= ~(1U << sl);
+            if (tlsf->sl_bitmap[fl] == 0U)
+            {
+                tlsf->fl_bitmap &= ~(1U << fl);
+            }
+        }
+    }
+}
+
+static void osal_tlsf_remove(osal_tlsf_t *tlsf, osal_tlsf_block_t *block)
+{
+    uint32_t fl;
+    uint32_t sl;
+    osal_tlsf_mapping_insert(osal_tlsf_block_size(block), &fl, &sl);
+    osal_tlsf_remove_free(tlsf, block, fl, sl);
+}
+
+static void osal_tlsf_insert(osal_tlsf_t *tlsf, osal_tlsf_block_t *block)
+{
+    uint32_t fl;
+    uint32_t sl;
+    osal_tlsf_block_t *head;
+
+    osal_tlsf_mapping_insert(osal_tlsf_block_size(block), &fl, &sl);
+    head = tlsf->free_lists[fl][sl];
+    block->next_free = head;
+    block->prev_free = NULL;
+    if (head != NULL)
+    {
+        head->prev_free = block;
+    }
+    tlsf->free_lists[fl][sl] = block;
+    tlsf->free_size += osal_tlsf_block_size(block);
+    tlsf->free_blocks++;
+    tlsf->fl_bitmap |= (1U << fl);
+    tlsf->sl_bitmap[fl] |= (1U << sl);
+    block->size |= OSAL_TLSF_BLOCK_FREE;
+}
+
+osal_tlsf_t *osal_tlsf_create(void *mem, size_t bytes)
+{
+    osal_tlsf_t *tlsf = (osal_tlsf_t *)OSAL_TLSF_ALIGN_UP(mem, OSAL_TLSF_ALIGN);
+    uint8_t *end = (uint8_t *)OSAL_TLSF_ALIGN_DOWN((uint8_t *)mem + bytes, OSAL_TLSF_ALIGN);
+    uint8_t *start = (uint8_t *)OSAL_TLSF_ALIGN_UP((uint8_t *)tlsf + sizeof(osal_tlsf_t), OSAL_TLSF_ALIGN);
+    osal_tlsf_block_t *block;
+    osal_tlsf_block_t *sentinel;
+    size_t size;
+
+    /* Room for the control structure, one minimal block and the end sentinel. */
+    if (mem == NULL || end < start || (size_t)(end - start) < 2U * OSAL_TLSF_HEADER_SIZE + OSAL_TLSF_PAYLOAD_MIN)
+    {
+        return NULL;
+    }
+    size = (size_t)(end - start) - 2U * OSAL_TLSF_HEADER_SIZE;
+    if (size > OSAL_TLSF_BLOCK_SIZE_MAX)
+    {
+        size = OSAL_TLSF_BLOCK_SIZE_MAX;
+    }
+
+    memset(tlsf, 0, sizeof(osal_tlsf_t));
+    block = (osal_tlsf_block_t *)start;
+    block->prev_phys = NULL;
+    block->size = size;
+    sentinel = osal_tlsf_block_next(block);
+    sentinel->prev_phys = block;
+    sentinel->size = 0;
+    tlsf->region_start = start;
+    tlsf->region_end = (uint8_t *)sentinel;
+    tlsf->total_size = size;
+    osal_tlsf_insert(tlsf, block);
+    tlsf->min_free_size = tlsf->free_size;
+    return tlsf;
+}
+
+static size_t osal_tlsf_adjust_size(size_t size)
+{
+    size = OSAL_TLSF_ALIGN_UP(size, OSAL_TLSF_ALIGN);
+    return (size < OSAL_TLSF_PAYLOAD_MIN) ? OSAL_TLSF_PAYLOAD_MIN : size;
+}
+
+/* Takes a free block of at least size bytes off its list and marks it used. */
+static osal_tlsf_block_t *osal_tlsf_locate_free(osal_tlsf_t *tlsf, size_t size)
+{
+    osal_tlsf_block_t *block;
+    uint32_t fl;
+    uint32_t sl;
+
+    osal_tlsf_mapping_search(size, &fl, &sl);
+    block = osal_tlsf_search_suitable(tlsf, &fl, &sl);
+    if (block == NULL)
+    {
+        tlsf->failed_count++;
+        return NULL;
+    }
+    osal_tlsf_remove_free(tlsf, block, fl, sl);
+    block->size &= ~OSAL_TLSF_BLOCK_FREE;
+    return block;
+}
+
+/* Gives the tail back when it can hold a block of its own, then accounts the allocation. */
+static void *osal_tlsf_prepare_used(osal_tlsf_t *tlsf, osal_tlsf_block_t *block, size_t size)
+{
+    size_t block_size = osal_tlsf_block_size(block);
+    if (block_size >= size + OSAL_TLSF_HEADER_SIZE + OSAL_TLSF_PAYLOAD_MIN)
+    {
+        osal_tlsf_block_t *remain = (osal_tlsf_block_t *)((uint8_t *)block + OSAL_TLSF_HEADER_SIZE + size);
+        remain->prev_phys = block;
+        remain->size = block_size - size - OSAL_TLSF_HEADER_SIZE;
+        osal_tlsf_block_next(remain)->prev_phys = remain;
+        block->size = size;
+        osal_tlsf_insert(tlsf, remain);
+    }
+
+    tlsf->alloc_count++;
+    if (tlsf->free_size < tlsf->min_free_size)
+    {
+        tlsf->min_free_size = tlsf->free_size;
+    }
+    return osal_tlsf_block_to_ptr(block);
+}
+
+void *osal_tlsf_malloc(osal_tlsf_t *tlsf, size_t size)
+{
+    osal_tlsf_block_t *block;
+
+    if (size == 0U || size > OSAL_TLSF_BLOCK_SIZE_MAX)
+    {
+        tlsf->failed_count++;
+        return NULL;
+    }
+    size = osal_tlsf_adjust_size(size);
+    block = osal_tlsf_locate_free(tlsf, size);
+    if (block == NULL)
+    {
+        return NULL;
+    }
+    return osal_tlsf_prepare_used(tlsf, block, size);
+}
+
+void *osal_tlsf_memalign(osal_tlsf_t *tlsf, size_t size, size_t align)
+{
+    const size_t gap_min = OSAL_TLSF_HEADER_SIZE + OSAL_TLSF_PAYLOAD_MIN;
+    osal_tlsf_block_t *block;
+    uintptr_t ptr;
+    uintptr_t aligned;
+
+    if (align <= OSAL_TLSF_ALIGN)
+    {
+        return osal_tlsf_malloc(tlsf, size);
+    }
+    if (size == 0U || size > OSAL_TLSF_BLOCK_SIZE_MAX - gap_min || align > OSAL_TLSF_BLOCK_SIZE_MAX - gap_min - size)
+    {
+        tlsf->failed_count++;
+        return NULL;
+    }
+    size = osal_tlsf_adjust_size(size);
+
+    /* Over-allocate so that a leading gap large enough to be a free block of its own always fits. */
+    block = osal_tlsf_locate_free(tlsf, size + align + gap_min);
+    if (block == NULL)
+    {
+        return NULL;
+    }
+    ptr = (uintptr_t)osal_tlsf_block_to_ptr(block);
+    aligned = OSAL_TLSF_ALIGN_UP(ptr, align);
+    if (aligned != ptr && aligned - ptr < gap_min)
+    {
+        aligned = OSAL_TLSF_ALIGN_UP(ptr + gap_min, align);
+    }
+    if (aligned != ptr)
+    {
+        /* Split off the gap, its physical predecessor is used since free blocks are always merged. */
+        osal_tlsf_block_t *aligned_block = osal_tlsf_block_from_ptr((void *)aligned);
+        aligned_block->prev_phys = block;
+        aligned_block->size = osal_tlsf_block_size(block) - (size_t)(aligned - ptr);
+        osal_tlsf_block_next(aligned_block)->prev_phys = aligned_block;
+        block->size = (size_t)(aligned - ptr) - OSAL_TLSF_HEADER_SIZE;
+        osal_tlsf_insert(tlsf, block);
+        block = aligned_block;
+    }
+    return osal_tlsf_prepare_used(tlsf, block, size);
+}
+
+void osal_tlsf_free(osal_tlsf_t *tlsf, void *ptr)
+{
+    osal_tlsf_block_t *block;
+    osal_tlsf_block_t *neighbour;
+
+    if ((uint8_t *)ptr < tlsf->region_start + OSAL_TLSF_HEADER_SIZE || (uint8_t *)ptr >= tlsf->region_end
+        || ((uintptr_t)ptr & (OSAL_TLSF_ALIGN - 1U)) != 0U)
+    {
+        return;
+    }
+    block = osal_tlsf_block_from_ptr(ptr);
+    if (osal_tlsf_block_is_free(block))
+    {
+        return;
+    }
+
+    tlsf->free_count++;
+    neighbour = block->prev_phys;
+    if (neighbour != NULL && osal_tlsf_block_is_free(neighbour))
+    {
+        osal_tlsf_remove(tlsf, neighbour);
+        neighbour->size = osal_tlsf_block_size(neighbour) + OSAL_TLSF_HEADER_SIZE + block->size;
+        block = neighbour;
+        osal_tlsf_block_next(block)->prev_phys = block;
+    }
+    neighbour = osal_tlsf_block_next(block);
+    if (osal_tlsf_block_is_free(neighbour))
+    {
+        osal_tlsf_remove(tlsf, neighbour);
+        block->size += OSAL_TLSF_HEADER_SIZE + osal_tlsf_block_size(neighbour);
+        osal_tlsf_block_next(block)->prev_phys = block;
+    }
+    osal_tlsf_insert(tlsf, block);
+}
+
+void osal_tlsf_get_stats(osal_tlsf_t *tlsf, osal_heap_stats_t *p_stats)
+{
+    size_t largest = 0;
+
+    if (tlsf->fl_bitmap != 0U)
+    {
+        uint32_t fl = osal_tlsf_fls(tlsf->fl_bitmap);
+        uint32_t sl = osal_tlsf_fls(tlsf->sl_bitmap[fl]);
+        for (osal_tlsf_block_t *block = tlsf->free_lists[fl][sl]; block != NULL; block = block->next_free)
+        {
+            if (osal_tlsf_block_size(block) > largest)
+            {
+                largest = osal_tlsf_block_size(block);
+            }
+        }
+    }
+    p_stats->total_size = tlsf->total_size;
+    p_stats->free_size = tlsf->free_size;
+    p_stats->min_ever_free_size = tlsf->min_free_size;
+    p_stats->largest_free_block = largest;
+    p_stats->free_blocks = tlsf->free_blocks;
+    p_stats->alloc_count = tlsf->alloc_count;
+    p_stats->free_count = tlsf->free_count;
+    p_stats->failed_count = tlsf->failed_count;
+}
+
+#if (OSAL_HEAP_USE_TLSF == 1)
+
+#if defined(OSAL_HEAP_REGION_START) && defined(OSAL_HEAP_REGION_END)
+/* Region placed by the linker script. */
+extern uint8_t OSAL_HEAP_REGION_START[];
+extern uint8_t OSAL_HEAP_REGION_END[];
+#define OSAL_TLSF_HEAP_BASE         (OSAL_HEAP_REGION_START)
+#define OSAL_TLSF_HEAP_SIZE         ((size_t)(OSAL_HEAP_REGION_END - OSAL_HEAP_REGION_START))
+#else
+static uint64_t osal_tlsf_heap_memory[OSAL_HEAP_POOL_SIZE / sizeof(uint64_t)];
+#define OSAL_TLSF_HEAP_BASE         (osal_tlsf_heap_memory)
+#define OSAL_TLSF_HEAP_SIZE         (sizeof(osal_tlsf_heap_memory))
+#endif
+
+static osal_tlsf_t *osal_tlsf_heap;
+
+/* Called inside the critical section. */
+static osal_tlsf_t *osal_tlsf_heap_get(void)
+{
+    if (osal_tlsf_heap == NULL)
+    {
+        osal_tlsf_heap = osal_tlsf_create(OSAL_TLSF_HEAP_BASE, OSAL_TLSF_HEAP_SIZE);
+    }
+    return osal_tlsf_heap;
+}
+
+void osal_tlsf_heap_init(void)
+{
+    uint32_t primask = os_enter_critical_impl();
+    (void)osal_tlsf_heap_get();
+    os_exit_critical_impl(primask);
+}
+
+void *osal_tlsf_heap_memalign(size_t wanted_size, size_t align)
+{
+    void *ptr = NULL;
+    uint32_t primask = os_enter_critical_impl();
+    if (osal_tlsf_heap_get() != NULL)
+    {
+        ptr = osal_tlsf_memalign(osal_tlsf_heap, wanted_size, align);
+    }
+    os_exit_critical_impl(primask);
+    if (ptr == NULL)
+    {
+        osal_heap_report_failure(wanted_size);
+    }
+    return ptr;
+}
+
+void *osal_tlsf_heap_malloc(size_t wanted_size)
+{
+    void *ptr = NULL;
+    uint32_t primask = os_enter_critical_impl();
+    if (osal_tlsf_heap_get() != NULL)
+    {
+        ptr = osal_tlsf_malloc(osal_tlsf_heap, wanted_size);
+    }
+    os_exit_critical_impl(primask);
+    if (ptr == NULL)
+    {
+        osal_heap_report_failure(wanted_size);
+    }
+    return ptr;
+}
+
+void osal_tlsf_heap_free(void *ptr)
+{
+    if (ptr != NULL && osal_tlsf_heap != NULL)
+    {
+        uint32_t primask = os_enter_critical_impl();
+        osal_tlsf_free(osal_tlsf_heap, ptr);
+        os_exit_critical_impl(primask);
+    }
+}
+
+void osal_tlsf_heap_get_stats(osal_heap_stats_t *p_stats)
+{
+    uint32_t primask = os_enter_critical_impl();
+    if (osal_tlsf_heap_get() != NULL)
+    {
+        osal_tlsf_get_stats(osal_tlsf_heap, p_stats);
+    }
+    os_exit_critical_impl(primask);
+}
+
+/* A word read, no lock needed for a threshold check. */
+size_t osal_tlsf_heap_get_free(void)
+{
+    osal_tlsf_t *tlsf = osal_tlsf_heap;
+    return (tlsf != NULL) ? tlsf->free_size : OSAL_TLSF_HEAP_SIZE;
+}
+
+#endif // OSAL_HEAP_USE_TLSF
@@ -0,0 +1,57 @@
+#include "osal_internal_wait.h"
+#include "osal_internal_globaldefs.h"
+
+//#include "app_log.h"
+
+int32_t osal_wait_set_create(size_t max_events, osal_wait_set_handle_t *p_set_handle)
+{
+    int32_t ret;
+    OSAL_CHECK_POINTER(p_set_handle);
+    OSAL_CHECK_SIZE(max_events);
+    ret = os_wait_set_create_impl(max_events, p_set_handle);
+    return ret;
+}
+
+int32_t osal_wait_set_delete(osal_wait_set_handle_t set_handle)
+{
+    int32_t ret;
+    OSAL_CHECK_POINTER(set_handle);
+    ret = os_wait_set_delete_impl(set_handle);
+    return ret;
+}
+
+int32_t osal_wait_set_add_queue(osal_wait_set_handle_t set_handle, osal_queue_handle_t queue_handle)
+{
+    int32_t ret;
+    OSAL_CHECK_POINTER(set_handle);
+    OSAL_CHECK_POINTER(queue_handle);
+    ret = os_wait_set_add_queue_impl(set_handle, queue_handle);
+    return ret;
+}
+
+int32_t osal_wait_set_add_sema(osal_wait_set_handle_t set_handle, osal_sema_handle_t sema_handle)
+{
+    int32_t ret;
+    OSAL_CHECK_POINTER(set_handle);
+    OSAL_CHECK_POINTER(sema_handle);
+    ret = os_wait_set_add_sema_impl(set_handle, sema_handle);
+    return ret;
+}
+
+int32_t osal_wait_set_remove(osal_wait_set_handle_t set_handle, void *member_handle)
+{
+    int32_t ret;
+    OSAL_CHECK_POINTER(set_handle);
+    OSAL_CHECK_POINTER(member_handle);
+    ret = os_wait_set_remove_impl(set_handle, member_handle);
+    return ret;
+}
+
+int32_t osal_wait_any(osal_wait_set_handle_t set_handle, void **p_ready_handle, osal_tick_type_t timeout)
+{
+    int32_t ret;
+    OSAL_CHECK_POINTER(set_handle);
+    OSAL_CHECK_POINTER(p_ready_handle);
+    ret = os_wait_any_impl(set_handle, p_ready_handle, timeout);
+    return ret;
+}
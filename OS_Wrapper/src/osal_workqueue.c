@@ -0,0 +1,392 @@
+#include "osal_workqueue.h"
+#include "osal_internal_task.h"
+#include "osal_internal_sema.h"
+#include "osal_internal_time.h"
+#include "osal_internal_heap.h"
+
+//#include "app_log.h"
+
+#define OSAL_WORK_IDLE      (0U)
+#define OSAL_WORK_PENDING   (1U)    // on the ready list
+#define OSAL_WORK_DELAYED   (2U)    // on the delayed list
+
+/* Lists, counters and work states are guarded by the critical section. */
+typedef struct
+{
+    osal_work_t *ready_head;
+    osal_work_t *ready_tail;
+    osal_work_t *delayed_head;      // sorted by due tick
+    osal_sema_handle_t wake;
+    uint32_t idle;                  // workers blocked on wake
+    uint32_t wakes;                 // gives not yet taken by one of them
+    uint32_t refs;                  // live workers, plus a running osal_workqueue_delete()
+    uint32_t n_workers;
+    uint32_t started;
+    bool stop;
+    osal_work_t **running;          // per worker, the work whose function it is in
+} osal_workqueue_t;
+
+/* True when the caller has to give wake once it leaves the critical section. */
+static bool osal_workqueue_wake_locked(osal_workqueue_t *wq)
+{
+    if (wq->wakes < wq->idle)
+    {
+        wq->wakes++;
+        return true;
+    }
+    return false;
+}
+
+static void osal_workqueue_ready_push(osal_workqueue_t *wq, osal_work_t *work)
+{
+    work->next = NULL;
+    work->state = OSAL_WORK_PENDING;
+    if (wq->ready_tail == NULL)
+    {
+        wq->ready_head = work;
+    }
+    else
+    {
+        wq->ready_tail->next = work;
+    }
+    wq->ready_tail = work;
+}
+
+/* Moves due delayed work to the ready list, returns the ticks until the next one (OSAL_MAX_DELAY: none). */
+static osal_tick_type_t osal_workqueue_release_due(osal_workqueue_t *wq, osal_tick_type_t now)
+{
+    while (wq->delayed_head != NULL)
+    {
+        osal_work_t *work = wq->delayed_head;
+        if (!osal_time_ticks_reached(now, work->due))
+        {
+            return osal_time_ticks_diff(work->due, now);
+        }
+        wq->delayed_head = work->next;
+        osal_workqueue_ready_push(wq, work);
+    }
+    return (osal_tick_type_t)OSAL_MAX_DELAY;
+}
+
+static void osal_workqueue_release(osal_workqueue_t *wq)
+{
+    uint32_t primask = os_enter_critical_impl();
+    bool last = (--wq->refs == 0U);
+    os_exit_critical_impl(primask);
+
+    if (last)
+    {
+        os_sema_delete_impl(wq->wake);
+        os_heap_free_impl(wq);
+    }
+}
+
+static void osal_workqueue_worker(void *argument)
+{
+    osal_workqueue_t *wq = (osal_workqueue_t *)argument;
+    uint32_t hz = os_time_tick_rate_hz_impl();
+    uint32_t primask;
+
+    primask = os_enter_critical_impl();
+    uint32_t index = wq->started++;
+    os_exit_critical_impl(primask);
+
+    for (;;)
+    {
+        osal_work_t *work;
+        bool wake = false;
+
+        primask = os_enter_critical_impl();
+        if (wq->stop)
+        {
+            os_exit_critical_impl(primask);
+            break;
+        }
+        osal_tick_type_t wait = osal_workqueue_release_due(wq, os_task_get_tick_count_impl());
+        work = wq->ready_head;
+        if (work != NULL)
+        {
+            wq->ready_head = work->next;
+            if (wq->ready_head == NULL)
+            {
+                wq->ready_tail = NULL;
+            }
+            else
+            {
+                wake = osal_workqueue_wake_locked(wq);    // spread a burst over idle workers
+            }
+            /* Idle before the call, the function may submit its work again or free it. */
+            work->state = OSAL_WORK_IDLE;
+            wq->running[index] = work;
+        }
+        else
+        {
+            wq->idle++;
+        }
+        os_exit_critical_impl(primask);
+
+        if (work != NULL)
+        {
+            if (wake)
+            {
+                (void)os_sema_give_impl(wq->wake);
+            }
+            work->fn(work->arg);
+
+            primask = os_enter_critical_impl();
+            wq->running[index] = NULL;
+            os_exit_critical_impl(primask);
+            continue;
+        }
+
+        /* Sleep until the next delayed work is due, rounded up so it never wakes early. */
+        osal_time_ms_t timeout = (osal_time_ms_t)OSAL_MAX_DELAY;
+        if (wait != (osal_tick_type_t)OSAL_MAX_DELAY)
+        {
+            uint64_t ms = ((uint64_t)wait * 1000U + hz - 1U) / hz;
+            timeout = (ms >= (uint64_t)OSAL_MAX_DELAY) ? (osal_time_ms_t)(OSAL_MAX_DELAY - 1U) : (osal_time_ms_t)ms;
+        }
+        int32_t ret = os_sema_take_impl(wq->wake, timeout);
+
+        primask = os_enter_critical_impl();
+        wq->idle--;
+        if (ret == OSAL_SUCCESS && wq->wakes > 0U)
+        {
+            wq->wakes--;
+        }
+        os_exit_critical_impl(primask);
+    }
+
+    osal_workqueue_release(wq);
+    osal_task_delete(NULL);
+}
+
+int32_t osal_workqueue_create(const char *task_name, uint32_t n_workers, osal_priority_t priority, size_t stack_size,
+                              osal_workqueue_handle_t *p_wq_handle)
+{
+    int32_t ret = OSAL_SUCCESS;
+    osal_workqueue_t *wq;
+    uint32_t created;
+
+    OSAL_CHECK_POINTER(p_wq_handle);
+    ARGCHECK(n_workers > 0U, OSAL_ERR_INVALID_ARGUMENT);
+    ARGCHECK(!OSAL_IS_IN_ISR(), OSAL_ERR_IN_ISR);
+
+    wq = (osal_workqueue_t *)os_heap_malloc_impl(sizeof(osal_workqueue_t) + n_workers * sizeof(osal_work_t *));
+    if (wq == NULL)
+    {
+        return OSAL_ERROR;
+    }
+    memset(wq, 0, sizeof(osal_workqueue_t) + n_workers * sizeof(osal_work_t *));
+    wq->running = (osal_work_t **)(wq + 1);
+    wq->n_workers = n_workers;
+    if (os_sema_countings_create_impl(&wq->wake, n_workers, 0U) != OSAL_SUCCESS)
+    {
+        os_heap_free_impl(wq);
+        return OSAL_ERROR;
+    }
+
+    /* The creator holds a reference until every worker is up, none can free the queue early. */
+    wq->refs = 1U;
+    for (created = 0U; created < n_workers; created++)
+    {
+        uint32_t primask = os_enter_critical_impl();
+        wq->refs++;
+        os_exit_critical_impl(primask);
+        ret = osal_task_create(task_name, osal_workqueue_worker, stack_size, priority, NULL, wq);
+        if (ret != OSAL_SUCCESS)
+        {
+            primask = os_enter_critical_impl();
+            wq->refs--;
+            os_exit_critical_impl(primask);
+            break;
+        }
+    }
+
+    if (ret != OSAL_SUCCESS)
+    {
+        *p_wq_handle = NULL;
+        (void)osal_workqueue_delete((osal_workqueue_handle_t)wq);
+        osal_workqueue_release(wq);
+        return ret;
+    }
+    *p_wq_handle = (osal_workqueue_handle_t)wq;
+    osal_workqueue_release(wq);
+    return OSAL_SUCCESS;
+}
+
+int32_t osal_workqueue_delete(osal_workqueue_handle_t wq_handle)
+{
+    osal_workqueue_t *wq = (osal_workqueue_t *)wq_handle;
+    uint32_t primask;
+    uint32_t gives;
+
+    OSAL_CHECK_POINTER(wq);
+    ARGCHECK(!OSAL_IS_IN_ISR(), OSAL_ERR_IN_ISR);
+
+    primask = os_enter_critical_impl();
+    if (wq->stop)
+    {
+        os_exit_critical_impl(primask);
+        return OSAL_ERR_INCORRECT_OBJ_STATE;
+    }
+    wq->stop = true;
+    wq->refs++;
+    for (osal_work_t *work = wq->ready_head; work != NULL; work = work->next)
+    {
+        work->state = OSAL_WORK_IDLE;
+    }
+    for (osal_work_t *work = wq->delayed_head; work != NULL; work = work->next)
+    {
+        work->state = OSAL_WORK_IDLE;
+    }
+    wq->ready_head = NULL;
+    wq->ready_tail = NULL;
+    wq->delayed_head = NULL;
+    /* wakes can briefly exceed idle when a worker timed out just as it was given. */
+    gives = (wq->idle > wq->wakes) ? (wq->idle - wq->wakes) : 0U;
+    wq->wakes += gives;
+    os_exit_critical_impl(primask);
+
+    while (gives-- > 0U)
+    {
+        (void)os_sema_give_impl(wq->wake);
+    }
+    osal_workqueue_release(wq);
+    return OSAL_SUCCESS;
+}
+
+void osal_work_init(osal_work_t *p_work, osal_work_fn_t fn, void *arg)
+{
+    if (p_work != NULL)
+    {
+        memset(p_work, 0, sizeof(osal_work_t));
+        p_work->fn = fn;
+        p_work->arg = arg;
+    }
+}
+
+static int32_t osal_work_queue(osal_workqueue_t *wq, osal_work_t *work, osal_time_ms_t delay_ms)
+{
+    int32_t ret = OSAL_SUCCESS;
+    bool wake = false;
+    osal_tick_type_t delay = 0U;
+
+    OSAL_CHECK_POINTER(wq);
+    OSAL_CHECK_POINTER(work);
+    OSAL_CHECK_POINTER(work->fn);
+
+    if (delay_ms != 0U)
+    {
+        delay = osal_time_ms_to_ticks_at(delay_ms, os_time_tick_rate_hz_impl());
+        ARGCHECK(delay <= (osal_tick_type_t)(OSAL_MAX_DELAY / 2U), OSAL_ERR_INVALID_ARGUMENT);
+    }
+
+    uint32_t primask = os_enter_critical_impl();
+    if (wq->stop)
+    {
+        ret = OSAL_ERR_INCORRECT_OBJ_STATE;
+    }
+    else if (work->state != OSAL_WORK_IDLE)
+    {
+        ret = (work->wq == (osal_workqueue_handle_t)wq) ? OSAL_SUCCESS : OSAL_ERR_OBJECT_IN_USE;
+    }
+    else if (delay == 0U)
+    {
+        work->wq = (osal_workqueue_handle_t)wq;
+        osal_workqueue_ready_push(wq, work);
+        wake = osal_workqueue_wake_locked(wq);
+    }
+    else
+    {
+        work->wq = (osal_workqueue_handle_t)wq;
+        work->due = (osal_tick_type_t)(os_task_get_tick_count_impl() + delay);
+        work->state = OSAL_WORK_DELAYED;
+
+        osal_work_t **pp = &wq->delayed_head;
+        while (*pp != NULL && osal_time_ticks_reached(work->due, (*pp)->due))
+        {
+            pp = &(*pp)->next;
+        }
+        work->next = *pp;
+        *pp = work;
+        /* A new earliest deadline, an idle worker has to shorten its wait. */
+        if (wq->delayed_head == work)
+        {
+            wake = osal_workqueue_wake_locked(wq);
+        }
+    }
+    os_exit_critical_impl(primask);
+
+    if (wake)
+    {
+        (void)os_sema_give_impl(wq->wake);
+    }
+    return ret;
+}
+
+int32_t osal_work_submit(osal_workqueue_handle_t wq_handle, osal_work_t *p_work)
+{
+    return osal_work_queue((osal_workqueue_t *)wq_handle, p_work, 0U);
+}
+
+int32_t osal_work_submit_from_isr(osal_workqueue_handle_t wq_handle, osal_work_t *p_work)
+{
+    return osal_work_queue((osal_workqueue_t *)wq_handle, p_work, 0U);
+}
+
+int32_t osal_work_submit_delayed(osal_workqueue_handle_t wq_handle, osal_work_t *p_work, osal_time_ms_t delay_ms)
+{
+    return osal_work_queue((osal_workqueue_t *)wq_handle, p_work, delay_ms);
+}
+
+static bool osal_work_unlink(osal_work_t **pp, osal_work_t *work, osal_work_t **p_tail)
+{
+    osal_work_t *prev = NULL;
+    for (; *pp != NULL; prev = *pp, pp = &(*pp)->next)
+    {
+        if (*pp == work)
+        {
+            *pp = work->next;
+            if (p_tail != NULL && *p_tail == work)
+            {
+                *p_tail = prev;
+            }
+            return true;
+        }
+    }
+    return false;
+}
+
+int32_t osal_work_cancel(osal_work_t *p_work)
+{
+    int32_t ret = OSAL_SUCCESS;
+
+    OSAL_CHECK_POINTER(p_work);
+
+    osal_workqueue_t *wq = (osal_workqueue_t *)p_work->wq;
+    if (wq == NULL)
+    {
+        return OSAL_SUCCESS;    // never submitted
+    }
+
+    uint32_t primask = os_enter_critical_impl();
+    if (p_work->state == OSAL_WORK_PENDING)
+    {
+        (void)osal_work_unlink(&wq->ready_head, p_work, &wq->ready_tail);
+    }
+    else if (p_work->state == OSAL_WORK_DELAYED)
+    {
+        (void)osal_work_unlink(&wq->delayed_head, p_work, NULL);
+    }
+    p_work->state = OSAL_WORK_IDLE;
+    for (uint32_t i = 0; i < wq->n_workers; i++)
+    {
+        if (wq->running[i] == p_work)
+        {
+            ret = OSAL_ERR_OBJECT_IN_USE;
+        }
+    }
+    os_exit_critical_impl(primask);
+    return ret;
+}